@@ -21,6 +21,21 @@
 
 // NOTE: this method can be *slow*, in special cases (v very sparse on output,
 // A in CSC format instead of the default CSR, or if A has any explicit values
+// FUTURE::: multi-source batched BFS: with the frontier as a thin
+// boolean n-by-s matrix (one column per source), each level is one
+// masked boolean SpMM, sharing one pass over A across all traversals.
+// This is expressible today with GrB_mxm over LOR_LAND and a
+// complemented visited mask; a supported engine would add per-column
+// termination and frontier compaction, and the SpMM panel kernel noted
+// in GB_AxB_saxpy3.c is the performance half.
+
+// FUTURE::: a supported GxB_bfs(parent, level, A, source): frontier and
+// visited-mask management belong in the library, but the push/pull
+// switch needs both orientations without per-iteration transposes (see
+// the direction-optimization note in GB_AxB_meta.c and the cached
+// transpose mirror note in GB_transpose.c); parent extraction needs the
+// positional semirings noted in GB_AxB_factory.c.  Those two
+// prerequisites are why the library function does not exist yet.
 // equal to zero in its pattern).  See LAGraph_bfs_pushpull for a faster method
 // that handles these cases.  Do not benchmark this code!  It is just for
 // simple illustration.  Use the LAGraph_bfs_pushpull for benchmarking and
@@ -24,6 +24,13 @@
 // Acknowledgements:  this method was written with input from Richard Veras,
 // Franz Franchetti, and Scott McMillan, Carnegie Mellon University.
 
+// FUTURE::: a fused PageRank iteration (SpMV accumulating the teleport
+// term, with the convergence norm computed in the same pass) would
+// collapse the five vector passes below into two.  The mxv+teleport half
+// is expressible today as C_in_place+=A'*x via the dense dot4 path with
+// an accumulator; the norm-in-same-pass half needs the fused
+// mxm+reduce machinery noted in GB_reduce_to_vector.c.
+
 #include "GraphBLAS.h"
 
 //------------------------------------------------------------------------------
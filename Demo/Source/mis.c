@@ -17,6 +17,12 @@
 // This method has been updated as of Version 2.2 of SuiteSparse:GraphBLAS.  It
 // now uses GrB_vxm instead of GrB_mxv.
 
+// FUTURE::: GxB_connectedComponents (FastSV-style hooking and
+// shortcutting with MIN-index propagation) is blocked on the positional
+// semirings noted in GB_AxB_factory.c; without them, label propagation
+// needs matrices of explicit indices, tripling memory, which is why only
+// this MIS demo ships today.
+
 #include "GraphBLAS.h"
 #undef GB_PUBLIC
 #define GB_LIBRARY
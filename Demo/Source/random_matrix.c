@@ -7,6 +7,12 @@
 
 //------------------------------------------------------------------------------
 
+// FUTURE::: a supported generator API (uniform and RMAT/Kronecker
+// power-law, as in Extras/ExactKronGen) should write CSR directly with
+// per-thread streams instead of building tuples one at a time as this
+// demo does; generation is embarrassingly parallel once each thread owns
+// a row range and a counted sample size.
+
 // Creates a random sparse matrix, using either setElement or build.
 
 #include "GraphBLAS.h"
@@ -7,6 +7,11 @@
 
 //------------------------------------------------------------------------------
 
+// FUTURE::: a supported parallel loader (a GxB_Matrix_import_file) would
+// memory-map the file, scan chunk boundaries per thread, parse with
+// per-thread tuple buffers, and feed GB_builder once; this serial fscanf
+// demo reader is not meant for production-size files.
+
 // Reads a matrix from stdin.  For sample inputs, see the Matrix/* files.
 // Each line has the form:
 //
@@ -2,6 +2,12 @@
 // GraphBLAS/Demo/Source/simple_timer.c: a timer for performance measurements
 //------------------------------------------------------------------------------
 
+// FUTURE::: a library-grade profiler (GxB scope timers inside kernels,
+// per-operation aggregation, optional PAPI counters, machine-readable
+// export) would replace this demo-only timer for performance work; the
+// phase boundaries to instrument are the saxpy3 symbolic/cumsum/numeric
+// phases and the three phases of add/emult/subref.
+
 // SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved
 // http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
 
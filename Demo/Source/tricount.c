@@ -2,6 +2,26 @@
 // GraphBLAS/Demo/Source/tricount.c: count the number of triangles in a graph
 //------------------------------------------------------------------------------
 
+// FUTURE::: beyond per-operation benchmarks, a soak harness modeling
+// production mixes -- concurrent reads under pending-tuple pressure,
+// format oscillation under mixed update/query streams, allocator
+// fragmentation over hours -- belongs beside the benchmark target noted
+// above, with the memory telemetry (GxB_MEMORY_INUSE/PEAK and
+// GxB_Matrix_memoryUsage) as its measurement substrate.
+
+// FUTURE::: a supported GxB_tricount would select among the methods
+// implemented below (Sandia L.L', Cohen, dot variants) from degree
+// statistics, which GxB_Matrix_rowDegree now provides in O(nvec); the
+// method table and its masked-multiply kernels are already in the
+// library, so the work is the selection model and a supported entry
+// point, not new kernels.
+
+// FUTURE::: a first-class benchmark target: a C harness sweeping
+// mxm/mxv/eWise/build/assign across sparsity regimes with machine-
+// readable output and stored baselines, built as `make bench`.  The demo
+// binaries (this one, bfs5m, the pagerank demos) are the seed corpus but
+// print human text and check nothing against a baseline.
+
 // SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
 // http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
 
@@ -12,6 +12,14 @@
 //
 //      type private/wathen
 
+// FUTURE::: GxB_Matrix_build_blocks (FEM-style assembly): a batch of
+// small dense blocks with per-block row/column index lists expands to
+// tuples internally today.  A block-aware builder would expand indices
+// per block while sorting block handles rather than tuples, assembling
+// duplicates with the dup operator at block granularity; the expansion
+// is where the 24-bytes-per-tuple cost goes away.  Until then,
+// GxB_Matrix_setElements amortizes the per-element API overhead.
+
 #include "GraphBLAS.h"
 #undef GB_PUBLIC
 #define GB_LIBRARY
@@ -33,6 +33,14 @@
     GrB_free (&supportop) ;             \
     GrB_free (&C) ;
 
+
+// FUTURE::: incremental k-truss: the from-scratch computation here redoes
+// nearly identical work after each small edge batch.  An incremental
+// object would consume insert/delete batches (riding the pending-tuple
+// machinery), re-examine only triangles incident on changed edges, and
+// maintain support counts persistently; deletions cascade, so the object
+// needs the affected subgraph frontier, not just the changed edges.
+
 #include "ktruss_graphblas_def.h"
 
 //------------------------------------------------------------------------------
@@ -1,3 +1,12 @@
+% FUTURE::: zero-copy interchange with built-in MATLAB sparse arrays:
+% the boundary currently deep-copies in both directions.  MATLAB CSC
+% doubles can alias a GrB_Matrix through the import/export API (the
+% layouts match for FP64 CSC with int64 indices via mxGetJc/Ir pun), but
+% MATLAB owns its memory through mxMalloc, so true adoption needs the
+% allocator registered at GxB_init to be the mx allocator -- which the
+% MEX interface already does -- plus copy-on-write semantics at the
+% MATLAB side.  Recorded here pending that design.
+
 % MATLAB interface for SuiteSparse:GraphBLAS
 %
 % GraphBLAS is a library for creating graph algorithms based on sparse linear
@@ -2259,6 +2259,19 @@ GrB_Info GrB_Vector_setElement          // w(i) = x
     (w, x, i)
 #endif
 
+//------------------------------------------------------------------------------
+// GrB_Vector_removeElement
+//------------------------------------------------------------------------------
+
+// Remove v(i), if it is present.  It is not an error if it is not present.
+
+GB_PUBLIC
+GrB_Info GrB_Vector_removeElement   // remove v(i), if it is present
+(
+    GrB_Vector v,                   // vector to remove an entry from
+    GrB_Index i                     // index
+) ;
+
 //------------------------------------------------------------------------------
 // GrB_Vector_extractElement
 //------------------------------------------------------------------------------
@@ -2998,6 +3011,41 @@ GrB_Info GrB_Matrix_setElement          // C (i,j) = x
     (C, x, i, j)
 #endif
 
+//------------------------------------------------------------------------------
+// GrB_Matrix_removeElement
+//------------------------------------------------------------------------------
+
+// Remove C(i,j), if it is present.  It is not an error if it is not present.
+
+GB_PUBLIC
+GrB_Info GrB_Matrix_removeElement   // remove C(row,col), if it is present
+(
+    GrB_Matrix C,                   // matrix to remove an entry from
+    GrB_Index row,                  // row index
+    GrB_Index col                   // column index
+) ;
+
+//------------------------------------------------------------------------------
+// GxB_Matrix_setElements: bulk update from a list of tuples
+//------------------------------------------------------------------------------
+
+// C(I(k),J(k)) = X(k) for all k, as if by nvals calls to
+// GrB_Matrix_setElement, except that duplicates within the batch are
+// combined with the dup operator (as in GrB_Matrix_build).  Entries of C
+// not referenced by the batch are unchanged.  X must be an array of
+// C's type.
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_setElements     // C(I(k),J(k)) = X(k), in bulk
+(
+    GrB_Matrix C,                   // matrix to update
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const void *X,                  // array of values, of type C->type
+    GrB_Index nvals,                // number of tuples
+    const GrB_BinaryOp dup          // binary op to assemble batch duplicates
+) ;
+
 //------------------------------------------------------------------------------
 // GrB_Matrix_extractElement
 //------------------------------------------------------------------------------
@@ -3658,7 +3706,25 @@ typedef enum            // for global options or matrix options
     GxB_API_DATE = 17,              // date of the API (char *)
     GxB_API_ABOUT = 18,             // about the API (char *)
     GxB_API_URL = 19,               // URL for the API (char *)
-    GxB_BURBLE = 20                 // development only (bool *)
+    GxB_BURBLE = 20,                // development only (bool *)
+
+    GxB_AXB_METHOD_COUNTS = 21,     // # of times each C=A*B kernel family
+                        // has been selected since GrB_init, in the order
+                        // dot2, dot3, dot4, saxpy3, rowscale, colscale
+                        // (6 int64_t's).  For calibrating the automatic
+                        // method selection against a given workload.
+
+    // GxB_Global_Option_get/set:
+    GxB_MALLOC_TRACKING = 22,       // if true, track all allocations so
+                        // that GxB_MEMORY_INUSE and GxB_MEMORY_PEAK are
+                        // maintained (bool).  Off by default: tracking
+                        // adds a critical section to every malloc/free.
+
+    // GxB_Global_Option_get only:
+    GxB_MEMORY_INUSE = 23,          // total bytes currently allocated by
+                        // GraphBLAS (int64_t); requires GxB_MALLOC_TRACKING
+    GxB_MEMORY_PEAK = 24            // high-water mark of GxB_MEMORY_INUSE
+                        // (int64_t); requires GxB_MALLOC_TRACKING
 
 } GxB_Option_Field ;
 
@@ -5458,6 +5524,46 @@ GrB_Info GrB_Matrix_apply           // C<Mask> = accum (C, op(A)) or op(A')
     const GrB_Descriptor desc       // descriptor for C, mask, and A
 ) ;
 
+//------------------------------------------------------------------------------
+// GxB_Matrix_eWiseUnion and GxB_Vector_eWiseUnion
+//------------------------------------------------------------------------------
+
+// eWiseUnion is like eWiseAdd, except that unmatched entries are not copied
+// through unchanged: when A(i,j) is present but B(i,j) is not,
+// C(i,j) = add (A(i,j), beta), and when only B(i,j) is present,
+// C(i,j) = add (alpha, B(i,j)).  The fill values alpha and beta are
+// GxB_Scalars, each of which must contain an entry.  This makes
+// subtraction-like unions a single pass: C = A-B is eWiseUnion with
+// GrB_MINUS_* and alpha = beta = 0.
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_eWiseUnion      // C<M> = accum (C, A+B) with fill
+(
+    GrB_Matrix C,                   // input/output matrix for results
+    const GrB_Matrix M,             // optional mask for C, unused if NULL
+    const GrB_BinaryOp accum,       // optional accum for Z=accum(C,T)
+    const GrB_BinaryOp add,         // defines '+' for T=A+B
+    const GrB_Matrix A,             // first input:  matrix A
+    const GxB_Scalar alpha,         // fill value when A(i,j) is not present
+    const GrB_Matrix B,             // second input: matrix B
+    const GxB_Scalar beta,          // fill value when B(i,j) is not present
+    const GrB_Descriptor desc       // descriptor for C, M, A, and B
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_eWiseUnion      // w<mask> = accum (w, u+v) with fill
+(
+    GrB_Vector w,                   // input/output vector for results
+    const GrB_Vector mask,          // optional mask for w, unused if NULL
+    const GrB_BinaryOp accum,       // optional accum for z=accum(w,t)
+    const GrB_BinaryOp add,         // defines '+' for t=u+v
+    const GrB_Vector u,             // first input:  vector u
+    const GxB_Scalar alpha,         // fill value when u(i) is not present
+    const GrB_Vector v,             // second input: vector v
+    const GxB_Scalar beta,          // fill value when v(i) is not present
+    const GrB_Descriptor desc       // descriptor for w and mask
+) ;
+
 //------------------------------------------------------------------------------
 // GrB_apply: generic matrix/vector apply
 //------------------------------------------------------------------------------
@@ -5479,6 +5585,219 @@ GrB_Info GrB_Matrix_apply           // C<Mask> = accum (C, op(A)) or op(A')
     (C, Mask, accum, op, A, desc)
 #endif
 
+//------------------------------------------------------------------------------
+// GxB_*_apply_BinaryOp1st and GxB_*_apply_BinaryOp2nd
+//------------------------------------------------------------------------------
+
+// Apply a binary operator to the entries in a matrix or vector, with a
+// scalar bound to the first or second operand of the operator:
+// C<Mask> = accum (C, op (x,A)) or C<Mask> = accum (C, op (A,y)).  The
+// scalar is a GxB_Scalar, which must contain exactly one entry.  These
+// extend GrB_apply in the same way GxB_select extends it with its Thunk.
+
+GB_PUBLIC
+GrB_Info GxB_Vector_apply_BinaryOp1st   // w<mask> = accum (w, op(x,u))
+(
+    GrB_Vector w,                   // input/output vector for results
+    const GrB_Vector mask,          // optional mask for w, unused if NULL
+    const GrB_BinaryOp accum,       // optional accum for z=accum(w,t)
+    const GrB_BinaryOp op,          // operator to apply to the entries
+    const GxB_Scalar x,             // scalar bound to the first operand
+    const GrB_Vector u,             // second input:  vector u
+    const GrB_Descriptor desc       // descriptor for w and mask
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_apply_BinaryOp2nd   // w<mask> = accum (w, op(u,y))
+(
+    GrB_Vector w,                   // input/output vector for results
+    const GrB_Vector mask,          // optional mask for w, unused if NULL
+    const GrB_BinaryOp accum,       // optional accum for z=accum(w,t)
+    const GrB_BinaryOp op,          // operator to apply to the entries
+    const GrB_Vector u,             // first input:  vector u
+    const GxB_Scalar y,             // scalar bound to the second operand
+    const GrB_Descriptor desc       // descriptor for w and mask
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_apply_BinaryOp1st   // C<Mask> = accum (C, op(x,A))
+(
+    GrB_Matrix C,                   // input/output matrix for results
+    const GrB_Matrix M,             // optional mask for C, unused if NULL
+    const GrB_BinaryOp accum,       // optional accum for Z=accum(C,T)
+    const GrB_BinaryOp op,          // operator to apply to the entries
+    const GxB_Scalar x,             // scalar bound to the first operand
+    const GrB_Matrix A,             // second input:  matrix A
+    const GrB_Descriptor desc       // descriptor for C, M, and A
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_apply_BinaryOp2nd   // C<Mask> = accum (C, op(A,y))
+(
+    GrB_Matrix C,                   // input/output matrix for results
+    const GrB_Matrix M,             // optional mask for C, unused if NULL
+    const GrB_BinaryOp accum,       // optional accum for Z=accum(C,T)
+    const GrB_BinaryOp op,          // operator to apply to the entries
+    const GrB_Matrix A,             // first input:  matrix A
+    const GxB_Scalar y,             // scalar bound to the second operand
+    const GrB_Descriptor desc       // descriptor for C, M, and A
+) ;
+
+//------------------------------------------------------------------------------
+// GxB_Matrix_memoryUsage
+//------------------------------------------------------------------------------
+
+// Report the bytes held by a matrix: header, vector pointers, hyperlist,
+// pattern, values, and pending tuples, counted at allocated capacity.
+// Cheap enough to poll; nothing is modified.
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_memoryUsage     // # of bytes held by a matrix
+(
+    size_t *size,                   // # of bytes
+    const GrB_Matrix A              // matrix to query
+) ;
+
+//------------------------------------------------------------------------------
+// GxB_Matrix_nvals_estimate
+//------------------------------------------------------------------------------
+
+// O(1) bounds on nvals without forcing the pending work to be assembled,
+// for monitoring probes in non-blocking mode: lower = live stored
+// entries, upper = lower + pending updates.  The bounds coincide (and
+// equal GrB_Matrix_nvals) when the matrix has no pending work.
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_nvals_estimate  // bounds on nvals, without assembly
+(
+    GrB_Index *lower,               // lower bound on nvals(A)
+    GrB_Index *upper,               // upper bound on nvals(A)
+    const GrB_Matrix A              // matrix to query
+) ;
+
+//------------------------------------------------------------------------------
+// GxB_Matrix_isequal
+//------------------------------------------------------------------------------
+
+// Test whether A and B have the same type, dimensions, pattern, and
+// bitwise-identical values, short-circuiting on the first difference: O(1)
+// on shape or count mismatches, one streaming early-exit pass in the
+// worst case, and never an eWiseMult temporary.  Values compare bitwise
+// (representation equality: identical NaNs are equal, +0 and -0 differ).
+// A and B must share the same CSR/CSC format, else GrB_NO_VALUE.
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_isequal     // test whether A and B are identical
+(
+    bool *result,               // true if A and B are equal
+    const GrB_Matrix A,         // first matrix
+    const GrB_Matrix B          // second matrix
+) ;
+
+//------------------------------------------------------------------------------
+// GxB_mxm_estimate
+//------------------------------------------------------------------------------
+
+// Estimate the cost of C<M>=A*B without computing it: *flops is the
+// number of multiply-add pairs the product would perform, and
+// *cnvals_bound is an upper bound on nnz(C).  The estimate is for the
+// matrices exactly as stored (no descriptor transposes); A, B, and M must
+// share the same CSR/CSC format, else GrB_NO_VALUE is returned.
+
+GB_PUBLIC
+GrB_Info GxB_mxm_estimate       // estimate the cost of C<M>=A*B
+(
+    double *flops,              // estimated # of multiply-add pairs
+    double *cnvals_bound,       // upper bound on nnz(C)
+    const GrB_Matrix M,         // optional mask, may be NULL
+    const GrB_Matrix A,         // first input: matrix A
+    const GrB_Matrix B          // second input: matrix B
+) ;
+
+//------------------------------------------------------------------------------
+// GxB_Matrix_validate
+//------------------------------------------------------------------------------
+
+// Lightweight structural validation: O(# of vectors) checks on the vector
+// pointers and hyperlist, plus sorted/bounds checks on the pattern of up
+// to nsamples sampled vectors.  Returns GrB_INVALID_OBJECT on corruption.
+// Unlike a full check, the cost does not grow with nnz unless nsamples
+// asks for it; pass nsamples >= # of vectors for a full pattern check.
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_validate    // check the structure of a matrix
+(
+    const GrB_Matrix A,         // matrix to validate
+    GrB_Index nsamples          // # of vectors whose pattern is checked
+) ;
+
+//------------------------------------------------------------------------------
+// GxB_Matrix_fit
+//------------------------------------------------------------------------------
+
+// Finish all pending work on the matrix and trim its capacity down to its
+// actual number of entries, returning the slack left by prior assign and
+// delete cycles to the allocator.  A small hysteresis (slack under 1/8th
+// of capacity) makes repeated fit calls cheap no-ops.
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_fit         // trim internal capacity to nnz(A)
+(
+    GrB_Matrix A                // matrix to trim
+) ;
+
+//------------------------------------------------------------------------------
+// GxB_Matrix_rowDegree and GxB_Matrix_colDegree
+//------------------------------------------------------------------------------
+
+// degree(k) = # of entries in the kth row (or column) of A, returned as a
+// new INT64 GrB_Vector with one entry for each non-empty row (or column).
+// When the requested direction matches the storage orientation of A the
+// result is read straight from the vector pointers in O(# of vectors)
+// time, with no pass over the entries and no temporary matrix.
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_rowDegree   // degree(i) = # of entries in A(i,:)
+(
+    GrB_Vector *degree,         // output: INT64 vector
+    const GrB_Matrix A          // input matrix
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_colDegree   // degree(j) = # of entries in A(:,j)
+(
+    GrB_Vector *degree,         // output: INT64 vector
+    const GrB_Matrix A          // input matrix
+) ;
+
+//------------------------------------------------------------------------------
+// GxB_Matrix_diag and GxB_Vector_diag
+//------------------------------------------------------------------------------
+
+// GxB_Matrix_diag constructs a square diagonal matrix from a vector:
+// C(i,i+j) = v(i) for j >= 0, or C(i-j,i) = v(i) for j < 0, in O(length(v))
+// time.  GxB_Vector_diag extracts the jth diagonal of a matrix into a
+// vector, finding each diagonal entry with a binary search in its row or
+// column, so it costs O(d log(degree)), not O(nnz(A)).  Any prior content
+// of v is cleared; its length must match the length of the jth diagonal.
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_diag        // C = diag (v,j)
+(
+    GrB_Matrix *C,              // output matrix
+    const GrB_Vector v,         // input vector
+    int64_t j                   // which diagonal to construct
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_diag        // v = diag (A,j)
+(
+    GrB_Vector v,               // output vector (any prior content cleared)
+    const GrB_Matrix A,         // input matrix
+    int64_t j,                  // which diagonal to extract
+    const GrB_Descriptor desc   // unused, except threading control
+) ;
+
 //------------------------------------------------------------------------------
 // matrix and vector selection
 //------------------------------------------------------------------------------
@@ -7050,4 +7369,10 @@ GrB_Info GxB_Vector_export  // export and free a vector
 // the result.
 
 #endif
+// FUTURE::: an official header-only C++ layer (templates mapping C++
+// types to GrB_Type, overloads resolving these operations at compile
+// time) belongs in a separate include that consumes only this public
+// API; the _Generic dispatch macros below are the C-side equivalent it
+// would mirror, so C++ callers stop re-deriving types at runtime.
+
 
@@ -197,11 +197,15 @@
 
     #define GB_PRAGMA(x) __pragma (x)
     #define GB_PRAGMA_SIMD
+    #define GB_PRAGMA_SIMD_REDUCTION(op,s)
 
 #else
 
     #define GB_PRAGMA(x) _Pragma (#x)
     #define GB_PRAGMA_SIMD GB_PRAGMA (omp simd)
+    // simd with an explicit reduction scalar, so that a monoid accumulation
+    // loop can vectorize without relying on unsafe math optimizations
+    #define GB_PRAGMA_SIMD_REDUCTION(op,s) GB_PRAGMA (omp simd reduction(op:s))
 
 #endif
 
@@ -2224,6 +2228,19 @@ GrB_Info GB_wait                // finish all pending computations
     GB_Context Context
 ) ;
 
+//------------------------------------------------------------------------------
+// GB_degree: compute the degree of each vector or index of a matrix
+//------------------------------------------------------------------------------
+
+GrB_Info GB_degree              // compute the degrees of a matrix
+(
+    GrB_Vector *degree,         // output: INT64 vector
+    const GrB_Matrix A,         // input matrix
+    const bool vector_degree,   // if true: degree of each vector of A,
+                                // else degree of each index of A
+    GB_Context Context
+) ;
+
 //------------------------------------------------------------------------------
 // GB_is_dense: check if a matrix is completely dense
 //------------------------------------------------------------------------------
@@ -2245,6 +2262,16 @@ static inline bool GB_is_dense
 // OpenMP definitions
 //------------------------------------------------------------------------------
 
+// FUTURE::: a persistent worker team: every operation opens fresh OpenMP
+// parallel regions, whose fork/join overhead dominates sub-millisecond
+// operations.  OpenMP runtimes already keep their worker pool alive
+// between regions, so the remaining cost is region entry itself; a
+// library-managed team with a task-dispatch interface would replace the
+// "parallel for" idiom in every kernel and interact with user-level
+// nesting, so it is an execution-engine change, not a local one.  The
+// small-operation path is kept cheap instead (stack workspace, fewer
+// allocations, single-task shortcuts that skip region entry).
+
 // GB_PART and GB_PARTITION:  divide the index range 0:n-1 uniformly
 // for nthreads.  GB_PART(tid,n,nthreads) is the first index for thread tid.
 #define GB_PART(tid,n,nthreads)  \
@@ -2960,6 +2987,14 @@ GB_PUBLIC mtx_t GB_sync ;
 }
 
 //------------------------------------------------------------------------------
+// FUTURE::: an optional hash map over A->h, built lazily on the first
+// lookup-heavy operation and invalidated whenever the hyperlist changes,
+// would turn these binary searches into O(1) for repeated access to a
+// large hypersparse matrix (dot3, repeated extracts).  The map belongs in
+// the matrix as a cached, disposable acceleration structure -- freed on
+// any pattern change, never serialized -- which needs the pattern-version
+// counter noted in GB_AxB_saxpy3.c.
+
 // GB_lookup: find k so that j == Ah [k]
 //------------------------------------------------------------------------------
 
@@ -27,6 +27,12 @@ GrB_Info GB_AxB_colscale            // C = A*D, column scale with diagonal D
 )
 {
 
+    //--------------------------------------------------------------------------
+    // record the method selection, for GxB_AXB_METHOD_COUNTS
+    //--------------------------------------------------------------------------
+
+    GB_Global_axb_stats_increment (GB_AXB_METHOD_COLSCALE) ;
+
     //--------------------------------------------------------------------------
     // check inputs
     //--------------------------------------------------------------------------
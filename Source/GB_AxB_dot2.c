@@ -53,6 +53,12 @@ GrB_Info GB_AxB_dot2                // C=A'*B or C<!M>=A'*B, dot product method
 )
 {
 
+    //--------------------------------------------------------------------------
+    // record the method selection, for GxB_AXB_METHOD_COUNTS
+    //--------------------------------------------------------------------------
+
+    GB_Global_axb_stats_increment (GB_AXB_METHOD_DOT2) ;
+
     //--------------------------------------------------------------------------
     // check inputs
     //--------------------------------------------------------------------------
@@ -378,17 +384,69 @@ GrB_Info GB_AxB_dot2                // C=A'*B or C<!M>=A'*B, dot product method
         #define GB_PRAGMA_VECTORIZE
         #define GB_PRAGMA_VECTORIZE_DOT
 
-        if (flipxy)
-        { 
-            #define GB_MULTIPLY(z,x,y) fmult (z,y,x)
-            #include "GB_AxB_dot2_meta.c"
-            #undef GB_MULTIPLY
+        // If no typecasting is being done, the scalar workspace and the
+        // cast of each entry are skipped, and fmult is applied directly to
+        // the entries of A and B (as in GB_AxB_saxpy3_generic.c).  This is
+        // the typical case for a user-defined semiring, where the types of
+        // A, B, and the multiplier match exactly.
+
+        bool nocasting = !A_is_pattern && !B_is_pattern
+            && (A->type == (flipxy ? mult->ytype : mult->xtype))
+            && (B->type == (flipxy ? mult->xtype : mult->ytype)) ;
+
+        if (nocasting)
+        {
+
+            // aki = A(k,i), located in Ax [pA], with no typecast or copy
+            #undef  GB_GETA
+            #define GB_GETA(aki,Ax,pA)                                      \
+                const GB_void *aki = Ax +((pA)*asize)
+
+            // bkj = B(k,j), located in Bx [pB], with no typecast or copy
+            #undef  GB_GETB
+            #define GB_GETB(bkj,Bx,pB)                                      \
+                const GB_void *bkj = Bx +((pB)*bsize)
+
+            if (flipxy)
+            {
+                #define GB_MULTIPLY(z,x,y) fmult (z,y,x)
+                #include "GB_AxB_dot2_meta.c"
+                #undef GB_MULTIPLY
+            }
+            else
+            {
+                #define GB_MULTIPLY(z,x,y) fmult (z,x,y)
+                #include "GB_AxB_dot2_meta.c"
+                #undef GB_MULTIPLY
+            }
         }
         else
-        { 
-            #define GB_MULTIPLY(z,x,y) fmult (z,x,y)
-            #include "GB_AxB_dot2_meta.c"
-            #undef GB_MULTIPLY
+        {
+
+            // aki = (xtype or ytype) A(k,i), located in Ax [pA]
+            #undef  GB_GETA
+            #define GB_GETA(aki,Ax,pA)                                      \
+                GB_void aki [GB_VLA(aki_size)] ;                            \
+                if (!A_is_pattern) cast_A (aki, Ax +((pA)*asize), asize)
+
+            // bkj = (ytype or xtype) B(k,j), located in Bx [pB]
+            #undef  GB_GETB
+            #define GB_GETB(bkj,Bx,pB)                                      \
+                GB_void bkj [GB_VLA(bkj_size)] ;                            \
+                if (!B_is_pattern) cast_B (bkj, Bx +((pB)*bsize), bsize)
+
+            if (flipxy)
+            {
+                #define GB_MULTIPLY(z,x,y) fmult (z,y,x)
+                #include "GB_AxB_dot2_meta.c"
+                #undef GB_MULTIPLY
+            }
+            else
+            {
+                #define GB_MULTIPLY(z,x,y) fmult (z,x,y)
+                #include "GB_AxB_dot2_meta.c"
+                #undef GB_MULTIPLY
+            }
         }
     }
 
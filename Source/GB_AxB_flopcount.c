@@ -80,8 +80,8 @@
 #define GB_FREE_WORK                                                        \
 {                                                                           \
     GB_ek_slice_free (&pstart_slice, &kfirst_slice, &klast_slice, ntasks) ; \
-    GB_FREE_MEMORY (Wfirst, ntasks, sizeof (int64_t)) ;                     \
-    GB_FREE_MEMORY (Wlast,  ntasks, sizeof (int64_t)) ;                     \
+    GB_FREE_MEMORY (Wfirst, 2*ntasks, sizeof (int64_t)) ;                  \
+    Wlast = NULL ;                                                          \
 }
 
 GB_PUBLIC   // accessed by the MATLAB tests in GraphBLAS/Test only
@@ -188,9 +188,10 @@ GrB_Info GB_AxB_flopcount
     // allocate workspace
     //--------------------------------------------------------------------------
 
-    GB_MALLOC_MEMORY (Wfirst, ntasks, sizeof (int64_t)) ;
-    GB_MALLOC_MEMORY (Wlast,  ntasks, sizeof (int64_t)) ;
-    if (Wfirst == NULL || Wlast == NULL)
+    // Wfirst and Wlast are allocated as a single block, owned by Wfirst
+    GB_MALLOC_MEMORY (Wfirst, 2*ntasks, sizeof (int64_t)) ;
+    Wlast = (Wfirst == NULL) ? NULL : Wfirst + ntasks ;
+    if (Wfirst == NULL)
     { 
         // out of memory
         GB_FREE_WORK ;
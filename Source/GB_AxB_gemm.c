@@ -0,0 +1,198 @@
+//------------------------------------------------------------------------------
+// GB_AxB_gemm: C=A*B or C=A'*B for dense matrices, via an external BLAS
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// When both A and B are completely dense, the values in A->x and B->x of a
+// sorted CSC (or CSR-agnostic) matrix are exactly a column-major dense array,
+// so C=A*B with the PLUS_TIMES_FP64 or PLUS_TIMES_FP32 semiring is a plain
+// GEMM, and a vendor BLAS reaches a far higher fraction of peak than the
+// sparse machinery.  This bridge is compiled in only when GB_WITH_CBLAS is
+// defined, and the caller must link against a CBLAS implementation; the
+// default build is unchanged.
+
+// The bridge handles C=A*B and C=A'*B (and C=A*B', C=A'*B', via the
+// transpose arguments of *gemm) with no mask and no typecasting.  The mask,
+// accumulator, and output orientation are all handled by the caller,
+// GB_AxB_meta, exactly as they are for the other AxB methods.
+
+#include "GB_mxm.h"
+
+#ifdef GB_WITH_CBLAS
+#include <cblas.h>
+#endif
+
+GrB_Info GB_AxB_gemm                // C = A*B via external BLAS, if possible
+(
+    GrB_Matrix *Chandle,            // output matrix
+    const GrB_Matrix A,             // input matrix A
+    const GrB_Matrix B,             // input matrix B
+    const GrB_Semiring semiring,    // semiring that defines C=A*B
+    const bool atrans,              // if true, compute C=A'*B
+    const bool btrans,              // if true, compute C=A*B'
+    bool *done,                     // if true, C=A*B was computed here
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (Chandle != NULL) ;
+    ASSERT (*Chandle == NULL) ;
+    ASSERT (done != NULL) ;
+    ASSERT_MATRIX_OK (A, "A for dense gemm A*B", GB0) ;
+    ASSERT_MATRIX_OK (B, "B for dense gemm A*B", GB0) ;
+    ASSERT (!GB_PENDING (A)) ; ASSERT (!GB_ZOMBIES (A)) ;
+    ASSERT (!GB_PENDING (B)) ; ASSERT (!GB_ZOMBIES (B)) ;
+    ASSERT_SEMIRING_OK (semiring, "semiring for dense gemm A*B", GB0) ;
+
+    (*done) = false ;
+
+    #ifndef GB_WITH_CBLAS
+
+        // no BLAS bridge compiled in; the caller selects another method
+        return (GrB_SUCCESS) ;
+
+    #else
+
+    //--------------------------------------------------------------------------
+    // determine if the BLAS bridge can be used
+    //--------------------------------------------------------------------------
+
+    // the semiring must be PLUS_TIMES_FP64 or PLUS_TIMES_FP32, with A and B
+    // of the matching type, so no typecasting is needed.  The TIMES
+    // multiplier is commutative, so flipxy need not be considered.
+
+    bool is_fp64 = (semiring == GxB_PLUS_TIMES_FP64)
+        && (A->type == GrB_FP64) && (B->type == GrB_FP64) ;
+    bool is_fp32 = (semiring == GxB_PLUS_TIMES_FP32)
+        && (A->type == GrB_FP32) && (B->type == GrB_FP32) ;
+
+    if (!is_fp64 && !is_fp32)
+    {
+        return (GrB_SUCCESS) ;
+    }
+
+    if (!GB_is_dense (A) || !GB_is_dense (B))
+    {
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // determine the dimensions of C = A*B, A'*B, A*B', or A'*B'
+    //--------------------------------------------------------------------------
+
+    int64_t cvlen = atrans ? A->vdim : A->vlen ;
+    int64_t k     = atrans ? A->vlen : A->vdim ;
+    int64_t cvdim = btrans ? B->vlen : B->vdim ;
+    ASSERT (k == (btrans ? B->vdim : B->vlen)) ;
+
+    // the BLAS takes int dimensions
+    if (cvlen > INT32_MAX || cvdim > INT32_MAX || k > INT32_MAX)
+    {
+        return (GrB_SUCCESS) ;
+    }
+
+    // skip degenerate dimensions: with k == 0 the sparse methods produce an
+    // empty pattern, but a GEMM with beta=0 would produce explicit zeros
+    if (cvlen == 0 || cvdim == 0 || k == 0)
+    {
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate the dense result C
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    GrB_Index cnzmax ;
+    if (!GB_Index_multiply (&cnzmax, cvlen, cvdim))
+    {
+        return (GrB_SUCCESS) ;
+    }
+
+    GrB_Matrix C = NULL ;
+    GB_CREATE (&C, semiring->add->op->ztype, cvlen, cvdim, GB_Ap_malloc,
+        true, GB_FORCE_NONHYPER, GB_HYPER_DEFAULT, cvdim, cnzmax, true,
+        Context) ;
+    if (info != GrB_SUCCESS)
+    {
+        // out of memory
+        return (info) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // construct the dense pattern of C
+    //--------------------------------------------------------------------------
+
+    int64_t *GB_RESTRICT Cp = C->p ;
+    int64_t *GB_RESTRICT Ci = C->i ;
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int nthreads = GB_nthreads (cnzmax, chunk, nthreads_max) ;
+
+    int64_t kC ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (kC = 0 ; kC <= cvdim ; kC++)
+    {
+        Cp [kC] = kC * cvlen ;
+    }
+
+    int64_t pC ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (pC = 0 ; pC < (int64_t) cnzmax ; pC++)
+    {
+        Ci [pC] = pC % cvlen ;
+    }
+
+    C->magic = GB_MAGIC ;
+    C->nvec_nonempty = (cvlen > 0) ? cvdim : 0 ;
+
+    //--------------------------------------------------------------------------
+    // C = A*B via the BLAS
+    //--------------------------------------------------------------------------
+
+    // The values of a dense matrix held by sorted sparse vectors are a
+    // column-major array in the CSR/CSC-agnostic sense: entry (i,j) of the
+    // vlen-by-vdim operand is at position i + j*vlen.
+
+    GBBURBLE ("dense gemm ") ;
+
+    if (is_fp64)
+    {
+        cblas_dgemm (CblasColMajor,
+            atrans ? CblasTrans : CblasNoTrans,
+            btrans ? CblasTrans : CblasNoTrans,
+            (int) cvlen, (int) cvdim, (int) k,
+            1.0, (const double *) A->x, (int) A->vlen,
+                 (const double *) B->x, (int) B->vlen,
+            0.0, (double *) C->x, (int) cvlen) ;
+    }
+    else
+    {
+        cblas_sgemm (CblasColMajor,
+            atrans ? CblasTrans : CblasNoTrans,
+            btrans ? CblasTrans : CblasNoTrans,
+            (int) cvlen, (int) cvdim, (int) k,
+            1.0f, (const float *) A->x, (int) A->vlen,
+                  (const float *) B->x, (int) B->vlen,
+            0.0f, (float *) C->x, (int) cvlen) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    ASSERT_MATRIX_OK (C, "C output for dense gemm A*B", GB0) ;
+    (*Chandle) = C ;
+    (*done) = true ;
+    return (GrB_SUCCESS) ;
+
+    #endif
+}
@@ -23,6 +23,19 @@
 // AxB_method_used is DOT, SAXPY, or DEFAULT (the latter denotes the row/col
 // scaling methods).
 
+// FUTURE::: a CUDA backend would hook in here as another method family
+// (device saxpy/dot/reduce/apply for built-in types), selected by an
+// offload model over the same flop estimates GxB_mxm_estimate exposes.
+// It is gated on device-resident matrix state (host/device/mirrored
+// placement with explicit transfer control) -- offload without residency
+// loses the win to PCIe transfers on iterative algorithms -- and on
+// pinned-host staging buffers, which conflict with the user-registered
+// allocator in the same way as aligned allocation (see
+// GB_malloc_memory.c).  All three belong to one accelerator design.
+// Placement state is the foundation: a location enum on the matrix,
+// transfers only at explicit sync points or placement changes, and a
+// mirrored mode for read-mostly iteration.
+
 // FUTURE:: an outer-product method for C=A*B'
 
 #define GB_FREE_ALL             \
@@ -222,6 +235,23 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
     // This rule is the same as that used by SuiteSparse/MATLAB_Tools/SSMULT,
     // which is the built-in sparse matrix multiply function in MATLAB.
 
+    // FUTURE::: decision audit and replay: the burble already narrates the
+    // selection here and GxB_AXB_METHOD_COUNTS tallies outcomes; a full
+    // audit log would also record the candidate estimates (flops,
+    // dimensions, density) so a logged decision can be replayed or pinned
+    // when a new version regresses a workload.  Replay needs a descriptor
+    // override per method site, as noted for the subassign methods in
+    // GB_subassigner.c.
+
+    // FUTURE::: the one case that still materializes the result twice is
+    // C=A'*B', computed as C=(B*A)': saxpy3 builds T=B*A and GB_accum_mask
+    // then runs a full bucket transpose of T.  A saxpy3 variant that
+    // scatters directly into per-thread transpose buckets during the numeric
+    // phase would save that pass, but it needs its own task structure and
+    // template expansion.  Until then, note that when nnz(C) is expected to
+    // be much larger than nnz(B'), transposing B explicitly and using the
+    // dot method for C=A'*BT can be cheaper than transposing the result.
+
     bool swap_rule =
         ( C_transpose &&  A_transpose &&  B_transpose) ||   // C' = A'*B'
         ( C_transpose &&  A_transpose && !B_transpose) ||   // C' = A'*B
@@ -311,6 +341,33 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
         GB_NROWS (B), GB_NCOLS (B), B->type->name, GB_NNZ (B)) ;
     #endif
 
+    //--------------------------------------------------------------------------
+    // dense-times-dense via an external BLAS, if enabled
+    //--------------------------------------------------------------------------
+
+    // When both operands are completely dense with a PLUS_TIMES_FP32/FP64
+    // semiring, a vendor GEMM beats the sparse machinery.  The bridge is a
+    // no-op unless compiled with GB_WITH_CBLAS; it handles any combination
+    // of atrans/btrans itself, and the output orientation is fixed up below
+    // as for all other methods.
+
+    if (M == NULL && !can_do_in_place && AxB_method == GxB_DEFAULT)
+    {
+        bool gemm_done = false ;
+        GB_OK (GB_AxB_gemm (Chandle, A, B, semiring, atrans, btrans,
+            &gemm_done, Context)) ;
+        if (gemm_done)
+        {
+            // C=A*B has been computed; no mask was present, and AT, BT, and
+            // MT were not created
+            GrB_Matrix C = (*Chandle) ;
+            C->is_csc = C_transpose ? !C_is_csc : C_is_csc ;
+            (*AxB_method_used) = GxB_AxB_SAXPY ;
+            ASSERT_MATRIX_OK (C, "C output for dense gemm A*B", GB0) ;
+            return (GrB_SUCCESS) ;
+        }
+    }
+
     //--------------------------------------------------------------------------
     // typecast A and B when transposing them, if needed
     //--------------------------------------------------------------------------
@@ -403,6 +460,17 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
         else if (AxB_method == GxB_DEFAULT)
         {
             // auto selection for A'*B
+
+            // FUTURE::: direction-optimizing vxm/mxv: when B is a sparse
+            // vector (a small BFS frontier), the saxpy method ("push") does
+            // work proportional to the frontier, while the dot method
+            // ("pull") visits every vector of A.  The switch cannot be made
+            // here with a single stored orientation, since push on A'*B
+            // requires materializing A' each call; it needs either a
+            // symmetric-matrix hint or an auto-maintained transpose mirror.
+            // Applications get the switch today by storing both orientations
+            // and alternating GrB_vxm/GrB_mxv, as LAGraph_bfs_pushpull does.
+
             if (M != NULL && !Mask_comp)
             { 
                 // C<M>=A'*B uses the masked dot product method
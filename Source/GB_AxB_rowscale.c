@@ -7,6 +7,11 @@
 
 //------------------------------------------------------------------------------
 
+// FUTURE::: fused sandwich scaling C=D1*A*D2: each GrB_mxm call sees only
+// one diagonal operand, so the rowscale and colscale passes cannot be fused
+// from here; a three-operand entry point (or deferred execution) would be
+// needed to apply d1(i)*a(i,j)*d2(j) in a single pass over A->x.
+
 #include "GB_mxm.h"
 #ifndef GBCOMPACT
 #include "GB_binop__include.h"
@@ -23,6 +28,12 @@ GrB_Info GB_AxB_rowscale            // C = D*B, row scale with diagonal D
 )
 {
 
+    //--------------------------------------------------------------------------
+    // record the method selection, for GxB_AXB_METHOD_COUNTS
+    //--------------------------------------------------------------------------
+
+    GB_Global_axb_stats_increment (GB_AXB_METHOD_ROWSCALE) ;
+
     //--------------------------------------------------------------------------
     // check inputs
     //--------------------------------------------------------------------------
@@ -81,6 +81,31 @@
 // Association for Computing Machinery, New York, NY, USA, Article 34, 1–10.
 // DOI:https://doi.org/10.1145/3229710.3229720
 
+// FUTURE::: a global transient-memory budget: the hash-table sizing
+// below is the largest single transient allocation in the library, and
+// it has cheaper fallbacks (smaller hash tables with more collisions,
+// or per-vector processing) that a budget could force instead of letting
+// allocation fail.  A GxB option holding the budget, decremented and
+// restored around workspace allocations, lets planners degrade methods
+// under pressure; the out-of-memory path then becomes a planning
+// decision instead of a failure.
+
+// FUTURE::: analyze/execute split: iterative solvers that call GrB_mxm
+// repeatedly on a fixed sparsity pattern redo the flop counts, the task
+// decomposition, the hash table sizing, and the symbolic phase every call.
+// All of that state is pattern-only (TaskList, hash sizes, Cp, and the Hf
+// marks), so a symbolic object could capture it once and replay
+// numeric-only passes.  It would have to be invalidated whenever A, B, or M
+// change pattern, which needs a pattern-version counter on GrB_Matrix.
+
+// FUTURE::: SpMM panel kernel: when B is a thin dense block (multi-source BFS
+// and propagation workloads multiply a sparse A by 8-64 dense vectors), each
+// vector of B is still computed in its own pass over A.  A panel variant of
+// the coarse Gustavson task would process several vectors of B per pass over
+// A, with Hx as a cvlen-by-b panel for register blocking.  This needs its own
+// template and factory expansion; the task heuristics above already select
+// the dense Gustavson workspace for this shape.
+
 //------------------------------------------------------------------------------
 
 #include "GB_mxm.h"
@@ -97,6 +122,13 @@
 #define GB_COSTLY 1.2
 #define GB_FINE_WORK 2
 #define GB_MWORK_ALPHA 0.01
+#define GB_DENSISH_BETA 0.10
+
+// upper bounds for keeping the task-construction workspace on the stack, so
+// that small problems (scored by # of tasks, not matrix dimension) construct
+// their tasks with no malloc/free traffic at all
+#define GB_STACK_NTASKS 4
+#define GB_STACK_NTHREADS 64
 
 //------------------------------------------------------------------------------
 // free workspace
@@ -106,7 +138,14 @@
 #define GB_FREE_INITIAL_WORK                                                \
 {                                                                           \
     GB_FREE_MEMORY (Bflops2, max_bjnz+1, sizeof (int64_t)) ;                \
-    GB_FREE_MEMORY (Coarse_Work, nthreads_max, sizeof (int64_t)) ;          \
+    if (Coarse_Work == Coarse_Work_stack)                                   \
+    {                                                                       \
+        Coarse_Work = NULL ;                                                \
+    }                                                                       \
+    else                                                                    \
+    {                                                                       \
+        GB_FREE_MEMORY (Coarse_Work, nthreads_max, sizeof (int64_t)) ;      \
+    }                                                                       \
     GB_FREE_MEMORY (Coarse_initial, ntasks_initial+1, sizeof (int64_t)) ;   \
     GB_FREE_MEMORY (Fine_slice, ntasks+1, sizeof (int64_t)) ;               \
 }
@@ -114,7 +153,14 @@
 #define GB_FREE_WORK                                                        \
 {                                                                           \
     GB_FREE_INITIAL_WORK ;                                                  \
-    GB_FREE_MEMORY (TaskList, ntasks, sizeof (GB_saxpy3task_struct)) ;      \
+    if (TaskList == TaskList_stack)                                         \
+    {                                                                       \
+        TaskList = NULL ;                                                   \
+    }                                                                       \
+    else                                                                    \
+    {                                                                       \
+        GB_FREE_MEMORY (TaskList, ntasks, sizeof (GB_saxpy3task_struct)) ;  \
+    }                                                                       \
     GB_FREE_MEMORY (Hi_all, Hi_size_total, sizeof (int64_t)) ;              \
     GB_FREE_MEMORY (Hf_all, Hf_size_total, sizeof (int64_t)) ;              \
     GB_FREE_MEMORY (Hx_all, Hx_size_total, 1) ;                             \
@@ -267,11 +313,17 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
     const GrB_Semiring semiring,    // semiring that defines C=A*B
     const bool flipxy,              // if true, do z=fmult(b,a) vs fmult(a,b)
     bool *mask_applied,             // if true, then mask was applied
-    const GrB_Desc_Value AxB_method,    // Default, Gustavson, or Hash
+    const GrB_Desc_Value AxB_method_input,  // Default, Gustavson, or Hash
     GB_Context Context
 )
 {
 
+    //--------------------------------------------------------------------------
+    // record the method selection, for GxB_AXB_METHOD_COUNTS
+    //--------------------------------------------------------------------------
+
+    GB_Global_axb_stats_increment (GB_AXB_METHOD_SAXPY3) ;
+
     //--------------------------------------------------------------------------
     // check inputs
     //--------------------------------------------------------------------------
@@ -280,6 +332,7 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
 
     GrB_Matrix M = M_input ;        // use the mask M, until deciding otherwise
     bool Mask_comp = Mask_comp_input ;
+    GrB_Desc_Value AxB_method = AxB_method_input ;
 
     (*mask_applied) = false ;
     ASSERT (Chandle != NULL) ;
@@ -301,6 +354,11 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
     int64_t *GB_RESTRICT Fine_slice = NULL ;
     int64_t *GB_RESTRICT Bflops2 = NULL ;
 
+    // stack space for the task list and flop-count workspace of small
+    // problems, used instead of malloc'd space when it is large enough
+    GB_saxpy3task_struct TaskList_stack [GB_STACK_NTASKS] ;
+    int64_t Coarse_Work_stack [GB_STACK_NTHREADS] ;
+
     int ntasks = 0 ;
     int ntasks_initial = 0 ;
     size_t Hi_size_total = 0 ;
@@ -468,6 +526,27 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
         GBBURBLE ("(use mask) ") ;
     }
 
+    //--------------------------------------------------------------------------
+    // determine if C is predicted to be dense-ish
+    //--------------------------------------------------------------------------
+
+    // The flop count is an upper bound on the number of entries in C.  If the
+    // flop count is large compared to the size of C, then most vectors of C
+    // are likely to be mostly dense, and the hash method saves no time or
+    // memory over Gustavson's method.  In that case, select Gustavson's
+    // method for all tasks, so that each task uses a bitmap-style dense
+    // accumulator (Hf of size cvlen, with no hash bookkeeping, collisions, or
+    // final sort by hash key).  This rule only refines the automatic
+    // selection; an explicit request for the hash method is obeyed.
+
+    if (AxB_method == GxB_DEFAULT && total_flops > 0 &&
+        ((double) total_flops) >=
+        GB_DENSISH_BETA * ((double) cvlen) * ((double) bnvec))
+    {
+        AxB_method = GxB_AxB_GUSTAVSON ;
+        GBBURBLE ("(C dense-ish: use Gustavson for all tasks) ") ;
+    }
+
     //--------------------------------------------------------------------------
     // get M
     //--------------------------------------------------------------------------
@@ -625,8 +704,24 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
     // allocate the tasks, and workspace to construct fine tasks
     //--------------------------------------------------------------------------
 
-    GB_CALLOC_MEMORY (TaskList, ntasks, sizeof (GB_saxpy3task_struct)) ;
-    GB_MALLOC_MEMORY (Coarse_Work, nthreads_max, sizeof (int64_t)) ;
+    if (ntasks <= GB_STACK_NTASKS)
+    {
+        // small problem: keep the task list on the stack
+        TaskList = TaskList_stack ;
+        memset (TaskList, 0, ntasks * sizeof (GB_saxpy3task_struct)) ;
+    }
+    else
+    {
+        GB_CALLOC_MEMORY (TaskList, ntasks, sizeof (GB_saxpy3task_struct)) ;
+    }
+    if (nthreads_max <= GB_STACK_NTHREADS)
+    {
+        Coarse_Work = Coarse_Work_stack ;
+    }
+    else
+    {
+        GB_MALLOC_MEMORY (Coarse_Work, nthreads_max, sizeof (int64_t)) ;
+    }
     if (max_bjnz > 0)
     { 
         // also allocate workspace to construct fine tasks
@@ -827,6 +922,40 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
         }
     }
 
+    //--------------------------------------------------------------------------
+    // order the coarse tasks by descending flop count
+    //--------------------------------------------------------------------------
+
+    // The symbolic and numeric phases execute the tasks with dynamic
+    // scheduling, so starting the heaviest coarse tasks first shortens the
+    // straggler tail that a few super-heavy vectors (the hub rows of
+    // power-law graphs) otherwise leave at the end of each phase.  Fine
+    // tasks stay in place: a team shares its workspace through the master
+    // task index, and the team order is significant.  Coarse tasks are
+    // independent of each other, but each one is its own master, so the
+    // master index is restored after the reordering.
+
+    if (ncoarse > 1)
+    {
+        for (int t = nfine+1 ; t < ntasks ; t++)
+        {
+            // insertion sort, in descending order of flops; the # of coarse
+            // tasks is O(nthreads) so a quadratic sort is fine
+            GB_saxpy3task_struct task = TaskList [t] ;
+            int t2 = t - 1 ;
+            while (t2 >= nfine && TaskList [t2].flops < task.flops)
+            {
+                TaskList [t2+1] = TaskList [t2] ;
+                t2-- ;
+            }
+            TaskList [t2+1] = task ;
+        }
+        for (int t = nfine ; t < ntasks ; t++)
+        {
+            TaskList [t].master = t ;
+        }
+    }
+
     //--------------------------------------------------------------------------
     // free workspace used to create the tasks
     //--------------------------------------------------------------------------
@@ -18,6 +18,12 @@
 // functions for the Hash method for C=A*B
 //------------------------------------------------------------------------------
 
+// FUTURE::: per-operation algorithmic counters (hash probes, collisions,
+// Gustavson scatters) would hang off the hash macros below, compiled in
+// only under a tracing build so the probe loops stay branch-free in
+// production; see the structured-trace note in GB_Global.c for where the
+// counts would surface.
+
 #define GB_HASH_FACTOR 107
 
 // initial hash function, for where to place the integer i in the hash table.
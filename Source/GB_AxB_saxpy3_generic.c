@@ -160,17 +160,76 @@ GrB_Info GB_AxB_saxpy3_generic
     // definitions for GB_AxB_saxpy3_template.c
     #include "GB_AxB_saxpy3_template.h"
 
-    if (flipxy)
-    { 
-        #define GB_MULTIPLY(z,x,y) fmult (z,y,x)
-        #include "GB_AxB_saxpy3_template.c"
-        #undef GB_MULTIPLY
+    // If no typecasting is being done, the scalar workspace and the cast of
+    // each entry are skipped, and fmult is applied directly to the entries of
+    // A and B.  This is the typical case for a user-defined semiring, where
+    // the types of A, B, and the multiplier match exactly.
+
+    bool nocasting = !A_is_pattern && !B_is_pattern
+        && (A->type == (flipxy ? mult->ytype : mult->xtype))
+        && (B->type == (flipxy ? mult->xtype : mult->ytype)) ;
+
+    if (nocasting)
+    {
+
+        //------------------------------------------------------------------
+        // C = A*B, with no typecasting of A or B
+        //------------------------------------------------------------------
+
+        // aik = A(i,k), located in Ax [pA], with no typecast or copy
+        #undef  GB_GETA
+        #define GB_GETA(aik,Ax,pA)                                      \
+            const GB_void *aik = Ax +((pA)*asize)
+
+        // bkj = B(k,j), located in Bx [pB], with no typecast or copy
+        #undef  GB_GETB
+        #define GB_GETB(bkj,Bx,pB)                                      \
+            const GB_void *bkj = Bx +((pB)*bsize)
+
+        if (flipxy)
+        {
+            #define GB_MULTIPLY(z,x,y) fmult (z,y,x)
+            #include "GB_AxB_saxpy3_template.c"
+            #undef GB_MULTIPLY
+        }
+        else
+        {
+            #define GB_MULTIPLY(z,x,y) fmult (z,x,y)
+            #include "GB_AxB_saxpy3_template.c"
+            #undef GB_MULTIPLY
+        }
     }
     else
-    { 
-        #define GB_MULTIPLY(z,x,y) fmult (z,x,y)
-        #include "GB_AxB_saxpy3_template.c"
-        #undef GB_MULTIPLY
+    {
+
+        //------------------------------------------------------------------
+        // C = A*B, with typecasting into scalar workspace
+        //------------------------------------------------------------------
+
+        // aik = (xtype or ytype) A(i,k), located in Ax [pA]
+        #undef  GB_GETA
+        #define GB_GETA(aik,Ax,pA)                                      \
+            GB_void aik [GB_VLA(aik_size)] ;                            \
+            if (!A_is_pattern) cast_A (aik, Ax +((pA)*asize), asize)
+
+        // bkj = (ytype or xtype) B(k,j), located in Bx [pB]
+        #undef  GB_GETB
+        #define GB_GETB(bkj,Bx,pB)                                      \
+            GB_void bkj [GB_VLA(bkj_size)] ;                            \
+            if (!B_is_pattern) cast_B (bkj, Bx +((pB)*bsize), bsize)
+
+        if (flipxy)
+        {
+            #define GB_MULTIPLY(z,x,y) fmult (z,y,x)
+            #include "GB_AxB_saxpy3_template.c"
+            #undef GB_MULTIPLY
+        }
+        else
+        {
+            #define GB_MULTIPLY(z,x,y) fmult (z,x,y)
+            #include "GB_AxB_saxpy3_template.c"
+            #undef GB_MULTIPLY
+        }
     }
 
     return (GrB_SUCCESS) ;
@@ -10,6 +10,28 @@
 // Determine if A*B uses a built-in semiring, and if so, determine the
 // opcodes and type codes of the semiring.
 
+// FUTURE::: a stable kernel ABI for out-of-tree kernels: a registration
+// call mapping (semiring, types) to a caller-provided worker with the
+// saxpy3/dot task-list calling convention would let private kernels
+// (quantized semirings, masked gathers) survive upgrades as plugins
+// instead of template patches.  The blocker is that the task structures
+// and template macros are internal and change between versions; the ABI
+// would have to freeze a documented subset (task list layout, Hf/Hx
+// contract) -- the same subset the analyze/execute split must expose,
+// so the two should be designed together.
+
+// FUTURE::: selective kernel profiles and loadable packs: between
+// GBCOMPACT (nothing) and the full 2431 kernels, a profile could compile
+// only a named semiring list (the coverage counters noted in the
+// generator tell a deployment which ones it needs), with this resolver
+// falling back to the generic workers for the rest.  Grouping the
+// generated kernels into per-monoid-family shared objects resolved here
+// lazily via dlopen serves mixed tenants with one binary; the resolver
+// below is the single place both schemes hook in.  For the dlopen form,
+// the pack boundary should follow the monoid family (one pack per
+// GB_AxB__<add>_* group) so a first-touch load pulls in every multiply
+// variant the workload will chain through.
+
 #include "GB_mxm.h"
 
 #ifndef GBCOMPACT
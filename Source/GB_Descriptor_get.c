@@ -75,6 +75,14 @@
 
 //      This is copied from the GrB_Descriptor into the Context.
 
+// FUTURE::: precompiled call plans: at millions of tiny calls per
+// second, re-validating the descriptor, types, and operator
+// compatibility dominates.  A GxB "call plan" object could capture the
+// validated (op, types, descriptor) combination once and let a
+// plan-based entry point skip these checks; it is the API-level
+// sibling of the analyze/execute split, and like it needs object
+// version counters so a freed or changed operand invalidates the plan.
+
 #include "GB.h"
 
 GB_PUBLIC   // accessed by the MATLAB tests in GraphBLAS/Test only
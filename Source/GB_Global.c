@@ -7,6 +7,20 @@
 
 //------------------------------------------------------------------------------
 
+// FUTURE::: structured per-operation tracing: the burble prints free text
+// for humans; observability stacks need one record per operation (op
+// kind, method, shapes, nnz, phase timings, threads, workspace bytes)
+// in a drainable ring buffer, with begin/end callback registration for
+// APM integration.  The AxB method counters (GxB_AXB_METHOD_COUNTS) are
+// the first structured slice of this; the record schema should subsume
+// them.  Per-operation algorithmic counters (hash probes, zombies
+// visited, tasks run) belong in the same record, gathered only when
+// tracing is enabled since the hot loops cannot afford unconditional
+// counting.  Begin/end callback registration (one pair around each
+// operation body, receiving the same record) is the APM-integration
+// face of the same machinery; callbacks must be invoked outside the
+// critical section and documented as non-reentrant into GrB.
+
 // All Global storage is declared, initialized, and accessed here.  The
 // contents of the GB_Global struct are only accessible to functions in this
 // file.  Global storage is used to record a list of matrices with pending
@@ -15,6 +29,7 @@
 // matrix options, and other settings.
 
 #include "GB.h"
+#include "GB_atomics.h"
 
 //------------------------------------------------------------------------------
 // Global storage: for all threads in a user application that uses GraphBLAS
@@ -125,6 +140,10 @@ typedef struct
     int64_t hack ;                  // ad hoc setting (for draft versions only)
     bool burble ;                   // controls GBBURBLE output
 
+    // # of times each AxB method has been selected since GrB_init, for
+    // calibrating the automatic method selection (see GB_AxB_meta)
+    int64_t axb_stats [GB_AXB_NMETHODS] ;
+
     //--------------------------------------------------------------------------
     // for MATLAB interface only
     //--------------------------------------------------------------------------
@@ -178,6 +197,7 @@ GB_Global_struct GB_Global =
     // for testing and development
     .hack = 0,
     .burble = false,
+    .axb_stats = {0},
 
     // for MATLAB interface only
     .print_one_based = false,       // if true, print 1-based indices
@@ -596,6 +616,23 @@ bool GB_Global_burble_get (void)
     return (GB_Global.burble) ;
 }
 
+//------------------------------------------------------------------------------
+// AxB method statistics
+//------------------------------------------------------------------------------
+
+void GB_Global_axb_stats_increment (int method)
+{ 
+    ASSERT (method >= 0 && method < GB_AXB_NMETHODS) ;
+    GB_ATOMIC_UPDATE
+    GB_Global.axb_stats [method]++ ;
+}
+
+int64_t GB_Global_axb_stats_get (int method)
+{ 
+    return ((method >= 0 && method < GB_AXB_NMETHODS) ?
+        GB_Global.axb_stats [method] : 0) ;
+}
+
 //------------------------------------------------------------------------------
 // for MATLAB interface only
 //------------------------------------------------------------------------------
@@ -118,6 +118,19 @@ void     GB_Global_burble_set (bool burble) ;
 GB_PUBLIC   // accessed by the MATLAB tests in GraphBLAS/Test only
 bool     GB_Global_burble_get (void) ;
 
+// slots for the AxB method selection statistics
+#define GB_AXB_METHOD_DOT2      0
+#define GB_AXB_METHOD_DOT3      1
+#define GB_AXB_METHOD_DOT4      2
+#define GB_AXB_METHOD_SAXPY3    3
+#define GB_AXB_METHOD_ROWSCALE  4
+#define GB_AXB_METHOD_COLSCALE  5
+#define GB_AXB_NMETHODS         6
+
+void     GB_Global_axb_stats_increment (int method) ;
+GB_PUBLIC   // accessed by the MATLAB tests in GraphBLAS/Test only
+int64_t  GB_Global_axb_stats_get (int method) ;
+
 GB_PUBLIC   // accessed by the MATLAB interface only
 void     GB_Global_print_one_based_set (bool onebased) ;
 GB_PUBLIC   // accessed by the MATLAB interface only
@@ -17,6 +17,12 @@
 // duplicates in I, and then construct the buckets in parallel after the qsort.
 // But the time complexity would be higher.
 
+// FUTURE::: the inverse index built here is rebuilt on every qualifying
+// subref; permutation-heavy pipelines reuse the same index list
+// thousands of times.  This workspace is the natural content of the
+// GxB_IndexSet object noted in GB_subassign_IxJ_slice.c -- one build,
+// many extracts -- and needs nothing else once that object exists.
+
 #include "GB_subref.h"
 
 GrB_Info GB_I_inverse           // invert the I list for C=A(I,:)
@@ -7,6 +7,39 @@
 
 //------------------------------------------------------------------------------
 
+// FUTURE::: lock-free multi-writer ingestion: concurrent setElement
+// callers serialize on this single pending list.  Striped per-thread
+// ingest buffers merged at GB_wait fit the builder (which already sorts
+// and merges), but the concurrency contract must change: GraphBLAS
+// currently requires external synchronization for concurrent writes to
+// one matrix, so this is an API-level guarantee, not just a data
+// structure.
+
+// FUTURE::: a per-matrix workload hint (read-mostly, append-heavy,
+// update-heavy) could steer the policies that are currently
+// one-size-fits-all: the initial pending-list size and growth here, the
+// nzmax growth/trim in GB_ix_resize, and the hypersparse conversion (for
+// which a per-matrix pin already exists via GxB_HYPER).  One enum option
+// on the matrix, consulted at those three sites, covers the request.
+
+// FUTURE::: per-vector (or per vector-range) pending lists, so that
+// assembling updates that touched only a few rows merges only the dirty
+// vectors, using the slicing machinery of GB_subassign_one_slice.  The
+// single global list forces GB_wait to merge against the whole matrix.
+// Bucketing changes every append site and the builder hand-off, and the
+// bucket count needs to adapt (a 10M-vector matrix cannot afford 10M
+// lists), so this is a data-structure revision, not a patch.
+
+// FUTURE::: a segmented pending-tuple store (a chain of fixed-size
+// segments) would avoid the realloc copies on growth, but GB_builder
+// consumes the list as contiguous iwork/jwork/xwork arrays, so segments
+// would have to be concatenated at assembly time -- one copy, which is
+// what the doubling realloc below already amortizes to.  The growth policy
+// doubles nmax (see GB_Pending_realloc), so long setElement bursts pay
+// O(log n) reallocs, and glibc remaps multi-GB blocks without copying.
+// The real win of segments is lock-free per-thread append, which needs
+// the concurrent-update design, not just a storage change.
+
 #ifndef GB_PENDING_H
 #define GB_PENDING_H
 #include "GB.h"
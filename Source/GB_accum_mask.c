@@ -244,8 +244,21 @@ GrB_Info GB_accum_mask          // C<M> = accum (C,T)
     int64_t cnpending = GB_Pending_n (C) ;  // # pending tuples in C
     int64_t tnz = GB_NNZ (T) ;
 
+    // FUTURE::: the add path below (Z=C+T, then C<M>=Z) makes two passes
+    // over C-sized data beyond the kernel itself.  The subassign path is
+    // already the fused form for small updates; extending its use to the
+    // large-T cases needs GB_add to write through the mask directly into
+    // C (a three-operand add), which is the peephole worth building --
+    // the temporaries Z and the mask pass then disappear for masked-
+    // accumulate mxm.
+
     // Use subassign for the accum/mask step if either M or accum is present
-    // (or both), and if the update is small compared to the size of C.
+    // (or both), and if the update is small compared to the size of C.  This
+    // is the in-place accumulation path: when nnz(T) is tiny relative to
+    // nnz(C), GB_subassigner scatter-accumulates into C->x directly and
+    // queues the few entries new to C's pattern as pending tuples, rather
+    // than rewriting C with GB_add -- so C += A with a small A never pays
+    // for a full rebuild of C here.
     // tnz+cnpending is an upper bound on the number of pending tuples in C
     // after the accum/mask step with subassign.  If this is small (< nnz(C)),
     // then use subassign.  It will be fast when T is very sparse and C has
@@ -340,7 +353,7 @@ GrB_Info GB_accum_mask          // C<M> = accum (C,T)
             }
 
             GB_OK (GB_add (&Z, C->type, C->is_csc, M1, Mask_struct, C, T,
-                accum, Context)) ;
+                accum, NULL, NULL, Context)) ;
             GB_MATRIX_FREE (Thandle) ;
         }
 
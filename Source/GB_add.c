@@ -33,6 +33,36 @@
 // Any duplicate pending tuples have already been summed in T, so the
 // intersection of T and A is always empty.
 
+// FUTURE::: GxB_eWiseAdd_multi, summing k matrices with one phase0/1/2
+// cycle and a k-way merge per task, instead of k-1 pairwise passes each
+// materializing an intermediate.  The phase0 analysis generalizes (the
+// union of k hyperlists), but the templates are written for two operands
+// throughout.  Until then, summing in a balanced pairwise tree costs
+// ceil(log2(k)) passes over data of roughly the final size, much less than
+// k-1 sequential accumulations into a dense-ish accumulator.
+
+// FUTURE::: prune-on-write: a per-matrix policy dropping entries equal
+// to a designated identity value as results are written (here and in
+// emult/apply/assign) would stop explicit zeros from accumulating over
+// long eWiseAdd chains.  It is the write-time form of select(NONZERO);
+// the phase1 counts must then also test values, which is why it is a
+// policy option and not free.  Until then, a periodic
+// GxB_select(GxB_NONZERO) plus GxB_Matrix_fit keeps pipelines clean.
+
+// FUTURE::: a reusable "add plan": iterative solvers that add matrices
+// with an unchanging union pattern could capture the phase0 analysis, the
+// task slices, and the final pattern of C once, then replay numeric-only
+// phase2 passes into a preallocated C.  Like the saxpy3 analyze/execute
+// split (see GB_AxB_saxpy3.c), safe reuse needs a pattern-version counter
+// on GrB_Matrix to invalidate the plan when an operand's pattern changes.
+
+// FUTURE::: a speculative single-pass mode could allocate C at the upper
+// bound nnz(A)+nnz(B), fill it in one fused pass, and trim with
+// GB_ix_resize.  With multiple tasks this still needs either per-task
+// counts (which is phase1) or a compaction pass over C, so the win is
+// limited to the sequential case; note also that phase1 is already O(1)
+// per vector when A(:,j) or B(:,j) is dense, or when they are disjoint.
+
 #include "GB_add.h"
 
 GB_PUBLIC   // accessed by the MATLAB tests in GraphBLAS/Test only
@@ -46,6 +76,8 @@ GrB_Info GB_add             // C=A+B or C<M>=A+B
     const GrB_Matrix A,     // input A matrix
     const GrB_Matrix B,     // input B matrix
     const GrB_BinaryOp op,  // op to perform C = op (A,B)
+    const GB_void *alpha,   // for eWiseUnion, or NULL (see GB_add.h)
+    const GB_void *beta,    // for eWiseUnion, or NULL
     GB_Context Context
 )
 {
@@ -158,7 +190,7 @@ GrB_Info GB_add             // C=A+B or C<M>=A+B
 
     info = GB_add_phase2 (
         // computed or used by phase2:
-        &C, ctype, C_is_csc, op,
+        &C, ctype, C_is_csc, op, alpha, beta,
         // from phase1:
         Cp, Cnvec_nonempty,
         // from phase0b:
@@ -22,6 +22,12 @@ GrB_Info GB_add             // C=A+B or C<M>=A+B
     const GrB_Matrix A,     // input A matrix
     const GrB_Matrix B,     // input B matrix
     const GrB_BinaryOp op,  // op to perform C = op (A,B)
+    const GB_void *alpha,   // for eWiseUnion: replaces A(i,j) when only
+                            // B(i,j) is present; typecast to op->xtype.
+                            // NULL for eWiseAdd
+    const GB_void *beta,    // for eWiseUnion: replaces B(i,j) when only
+                            // A(i,j) is present; typecast to op->ytype.
+                            // NULL for eWiseAdd
     GB_Context Context
 ) ;
 
@@ -69,6 +75,8 @@ GrB_Info GB_add_phase2      // C=A+B or C<M>=A+B
     const GrB_Type ctype,   // type of output matrix C
     const bool C_is_csc,    // format of output matrix C
     const GrB_BinaryOp op,  // op to perform C = op (A,B), or NULL if no op
+    const GB_void *alpha,   // eWiseUnion fill for A, or NULL (see GB_add)
+    const GB_void *beta,    // eWiseUnion fill for B, or NULL
     // from phase1:
     const int64_t *GB_RESTRICT Cp,         // vector pointers for C
     const int64_t Cnvec_nonempty,       // # of non-empty vectors in C
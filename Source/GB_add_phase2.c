@@ -37,6 +37,8 @@ GrB_Info GB_add_phase2      // C=A+B or C<M>=A+B
     const GrB_Type ctype,   // type of output matrix C
     const bool C_is_csc,    // format of output matrix C
     const GrB_BinaryOp op,  // op to perform C = op (A,B), or NULL if no op
+    const GB_void *alpha,   // eWiseUnion fill for A, or NULL (see GB_add)
+    const GB_void *beta,    // eWiseUnion fill for B, or NULL
     // from phase1:
     const int64_t *GB_RESTRICT Cp,         // vector pointers for C
     const int64_t Cnvec_nonempty,       // # of non-empty vectors in C
@@ -161,7 +163,8 @@ GrB_Info GB_add_phase2      // C=A+B or C<M>=A+B
     GB_Opcode opcode ;
     GB_Type_code xycode, zcode ;
 
-    if (GB_binop_builtin (A->type, false, B->type, false, op,
+    if (alpha == NULL && beta == NULL &&
+        GB_binop_builtin (A->type, false, B->type, false, op,
         false, &opcode, &xycode, &zcode) && ccode == zcode)
     { 
         #include "GB_binop_factory.c"
@@ -216,13 +219,37 @@ GrB_Info GB_add_phase2      // C=A+B or C<M>=A+B
             cast_Z_to_C = GB_cast_factory (ccode,           op->ztype->code) ;
         }
 
-        // C(i,j) = (ctype) A(i,j), located in Ax [pA]
+        // C(i,j) = (ctype) A(i,j), located in Ax [pA]; for eWiseUnion,
+        // B(i,j) is not present, so C(i,j) = op (A(i,j), beta) instead
         #define GB_COPY_A_TO_C(cij,Ax,pA)                                   \
-            cast_A_to_C (cij, Ax +((pA)*asize), asize) ;
-
-        // C(i,j) = (ctype) B(i,j), located in Bx [pB]
+            if (beta == NULL)                                               \
+            {                                                               \
+                cast_A_to_C (cij, Ax +((pA)*asize), asize) ;                \
+            }                                                               \
+            else                                                            \
+            {                                                               \
+                GB_void xwork [GB_VLA(xsize)] ;                             \
+                cast_A_to_X (xwork, Ax +((pA)*asize), asize) ;              \
+                GB_void zwork [GB_VLA(zsize)] ;                             \
+                fadd (zwork, xwork, beta) ;                                 \
+                cast_Z_to_C (cij, zwork, csize) ;                           \
+            }
+
+        // C(i,j) = (ctype) B(i,j), located in Bx [pB]; for eWiseUnion,
+        // A(i,j) is not present, so C(i,j) = op (alpha, B(i,j)) instead
         #define GB_COPY_B_TO_C(cij,Bx,pB)                                   \
-            cast_B_to_C (cij, Bx +((pB)*bsize), bsize) ;
+            if (alpha == NULL)                                              \
+            {                                                               \
+                cast_B_to_C (cij, Bx +((pB)*bsize), bsize) ;                \
+            }                                                               \
+            else                                                            \
+            {                                                               \
+                GB_void ywork [GB_VLA(ysize)] ;                             \
+                cast_B_to_Y (ywork, Bx +((pB)*bsize), bsize) ;              \
+                GB_void zwork [GB_VLA(zsize)] ;                             \
+                fadd (zwork, alpha, ywork) ;                                \
+                cast_Z_to_C (cij, zwork, csize) ;                           \
+            }
 
         // aij = (xtype) A(i,j), located in Ax [pA]
         #define GB_GETA(aij,Ax,pA)                                          \
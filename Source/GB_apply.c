@@ -11,6 +11,12 @@
 
 // GB_apply does the work for GrB_*_apply.  Compare this with GrB_transpose.
 
+// FUTURE::: an apply variant that drops operator-produced zeros would
+// need phase1/phase2 structure (count surviving entries, then fill), at
+// which point it is the fused select+apply noted in GB_selector.c with
+// the NONZERO selector; implement it there rather than growing apply a
+// counting pass.
+
 #include "GB_apply.h"
 #include "GB_transpose.h"
 #include "GB_accum_mask.h"
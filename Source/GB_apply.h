@@ -45,4 +45,43 @@ GrB_Info GB_shallow_op      // create shallow matrix and apply operator
     GB_Context Context
 ) ;
 
+GrB_Info GB_apply_bind              // C<M> = accum (C, op(x,A)) or op(A,y)
+(
+    GrB_Matrix C,                   // input/output matrix for results
+    const bool C_replace,           // C descriptor
+    const GrB_Matrix M,             // optional mask for C, unused if NULL
+    const bool Mask_comp,           // M descriptor
+    const bool Mask_struct,         // if true, use the only structure of M
+    const GrB_BinaryOp accum,       // optional accum for Z=accum(C,T)
+    const GrB_BinaryOp op,          // operator to apply to the entries
+    const GB_void *scalar,          // typecast to op->xtype or op->ytype
+    const bool bind_first,          // if true, T=op(scalar,A) else op(A,scalar)
+    const GrB_Matrix A,             // first input:  matrix A
+    bool A_transpose,               // A matrix descriptor
+    GB_Context Context
+) ;
+
+GrB_Info GB_shallow_bind    // create shallow matrix, apply bound binary op
+(
+    GrB_Matrix *Chandle,    // output matrix C, of type op->ztype
+    const bool C_is_csc,    // desired CSR/CSC format of C
+    const GrB_BinaryOp op,  // operator to apply
+    const GB_void *scalar,  // typecast to op->xtype or op->ytype
+    const bool bind_first,  // if true, C = op (scalar, A), else op (A, scalar)
+    const GrB_Matrix A,     // input matrix
+    GB_Context Context
+) ;
+
+void GB_apply_bind_op       // apply a binary op with a bound scalar
+(
+    GB_void *GB_RESTRICT Cx,        // output array, of type op->ztype
+    const GrB_BinaryOp op,          // operator to apply
+    const GB_void *scalar,          // typecast to op->xtype or op->ytype
+    const bool bind_first,          // if true, Cx = op (scalar, Ax)
+    const GB_void *GB_RESTRICT Ax,  // input array, of type Atype
+    const GrB_Type Atype,           // type of Ax
+    const int64_t anz,              // size of Ax and Cx
+    GB_Context Context
+) ;
+
 #endif
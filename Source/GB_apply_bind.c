@@ -0,0 +1,144 @@
+//------------------------------------------------------------------------------
+// GB_apply_bind: apply a binary operator with a bound scalar; may transpose
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// C<M> = accum (C, op(x,A)), accum (C, op(A,y)), or the same with A'.
+
+// GB_apply_bind does the work for GxB_*_apply_BinaryOp1st and
+// GxB_*_apply_BinaryOp2nd.  The scalar has already been typecast by the
+// caller to op->xtype (bind_first true) or op->ytype (bind_first false).
+// Compare with GB_apply.c.
+
+#include "GB_apply.h"
+#include "GB_transpose.h"
+#include "GB_accum_mask.h"
+
+GrB_Info GB_apply_bind              // C<M> = accum (C, op(x,A)) or op(A,y)
+(
+    GrB_Matrix C,                   // input/output matrix for results
+    const bool C_replace,           // C descriptor
+    const GrB_Matrix M,             // optional mask for C, unused if NULL
+    const bool Mask_comp,           // M descriptor
+    const bool Mask_struct,         // if true, use the only structure of M
+    const GrB_BinaryOp accum,       // optional accum for Z=accum(C,T)
+    const GrB_BinaryOp op,          // operator to apply to the entries
+    const GB_void *scalar,          // typecast to op->xtype or op->ytype
+    const bool bind_first,          // if true, T = op(scalar,A) else op(A,scalar)
+    const GrB_Matrix A,             // first input:  matrix A
+    bool A_transpose,               // A matrix descriptor
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    // C may be aliased with M and/or A
+
+    GB_RETURN_IF_FAULTY (accum) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (op) ;
+
+    ASSERT_MATRIX_OK (C, "C input for GB_apply_bind", GB0) ;
+    ASSERT_MATRIX_OK_OR_NULL (M, "M for GB_apply_bind", GB0) ;
+    ASSERT_BINARYOP_OK_OR_NULL (accum, "accum for GB_apply_bind", GB0) ;
+    ASSERT_BINARYOP_OK (op, "op for GB_apply_bind", GB0) ;
+    ASSERT_MATRIX_OK (A, "A input for GB_apply_bind", GB0) ;
+    ASSERT (scalar != NULL) ;
+
+    // check domains and dimensions for C<M> = accum (C,T)
+    GrB_Type T_type = op->ztype ;
+    GrB_Info info = GB_compatible (C->type, C, M, accum, T_type, Context) ;
+    if (info != GrB_SUCCESS)
+    {
+        return (info) ;
+    }
+
+    // A must be compatible with the unbound operand of the operator
+    GrB_Type atype_required = bind_first ? op->ytype : op->xtype ;
+    if (!GB_Type_compatible (A->type, atype_required))
+    {
+        return (GB_ERROR (GrB_DOMAIN_MISMATCH, (GB_LOG,
+            "incompatible type for z=%s(x,y):\n"
+            "input A type [%s]\n"
+            "cannot be typecast to operator input of type [%s]",
+            op->name, A->type->name, atype_required->name))) ;
+    }
+
+    // check the dimensions
+    int64_t tnrows = (A_transpose) ? GB_NCOLS (A) : GB_NROWS (A) ;
+    int64_t tncols = (A_transpose) ? GB_NROWS (A) : GB_NCOLS (A) ;
+    if (GB_NROWS (C) != tnrows || GB_NCOLS (C) != tncols)
+    {
+        return (GB_ERROR (GrB_DIMENSION_MISMATCH, (GB_LOG,
+            "Dimensions not compatible:\n"
+            "output is "GBd"-by-"GBd"\n"
+            "input is "GBd"-by-"GBd"%s",
+            GB_NROWS (C), GB_NCOLS (C),
+            tnrows, tncols, A_transpose ? " (transposed)" : ""))) ;
+    }
+
+    // quick return if an empty mask is complemented
+    GB_RETURN_IF_QUICK_MASK (C, C_replace, M, Mask_comp) ;
+
+    // delete any lingering zombies and assemble any pending tuples
+    GB_WAIT (M) ;
+    GB_WAIT (A) ;
+
+    //--------------------------------------------------------------------------
+    // T = op(x,A), op(A,y), or the same with A'
+    //--------------------------------------------------------------------------
+
+    bool C_is_csc = C->is_csc ;
+    if (C_is_csc != A->is_csc)
+    {
+        // Flip the sense of A_transpose
+        A_transpose = !A_transpose ;
+    }
+
+    GrB_Matrix T = NULL ;
+
+    if (A_transpose)
+    {
+        // T1 = op (A) with a shallow pattern, then T = T1', freeing T1.  The
+        // transpose cannot be fused with a binary op, so the values are
+        // computed first and transposed with no typecast and no op.
+        GBBURBLE ("(bind-op, then transpose) ") ;
+        GrB_Matrix T1 = NULL ;
+        info = GB_shallow_bind (&T1, A->is_csc, op, scalar, bind_first, A,
+            Context) ;
+        if (info == GrB_SUCCESS)
+        {
+            // transpose: no typecast, no op, not in place
+            info = GB_transpose (&T, NULL, C_is_csc, T1, NULL, Context) ;
+        }
+        GB_MATRIX_FREE (&T1) ;
+    }
+    else
+    {
+        // T = op (A), pattern is a shallow copy of A, type is op->ztype
+        GBBURBLE ("(shallow bind-op) ") ;
+        info = GB_shallow_bind (&T, C_is_csc, op, scalar, bind_first, A,
+            Context) ;
+    }
+
+    if (info != GrB_SUCCESS)
+    {
+        GB_MATRIX_FREE (&T) ;
+        return (info) ;
+    }
+
+    ASSERT (T->is_csc == C->is_csc) ;
+
+    //--------------------------------------------------------------------------
+    // C<M> = accum (C,T): accumulate the results into C via the M
+    //--------------------------------------------------------------------------
+
+    return (GB_accum_mask (C, M, NULL, accum, &T, C_replace, Mask_comp,
+        Mask_struct, Context)) ;
+}
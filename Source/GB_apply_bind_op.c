@@ -0,0 +1,129 @@
+//------------------------------------------------------------------------------
+// GB_apply_bind_op: apply a binary operator with a bound scalar to an array
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// Cx = op (scalar, (ytype) Ax), or Cx = op ((xtype) Ax, scalar)
+
+// The scalar has already been typecast by the caller to op->xtype (if
+// bind_first is true) or op->ytype (if bind_first is false).
+
+// Cx and Ax may be aliased.  Compare with GB_apply_op.c.
+
+// FUTURE::: size-specialized generic kernels: user-defined values move
+// through memcpy with a runtime size here and in the builder and
+// subassign workers.  Compiling the generic loops a few extra times with
+// the size fixed at 4, 8, and 16 bytes would let the compiler inline the
+// moves for the common user structs, dispatched by a switch on the size;
+// the VLA scalar-workspace forms are already bypassed when no typecast
+// is needed.
+
+#include "GB_apply.h"
+
+void GB_apply_bind_op       // apply a binary op with a bound scalar
+(
+    GB_void *GB_RESTRICT Cx,        // output array, of type op->ztype
+    const GrB_BinaryOp op,          // operator to apply
+    const GB_void *scalar,          // typecast to op->xtype or op->ytype
+    const bool bind_first,          // if true, Cx = op (scalar, Ax)
+    const GB_void *GB_RESTRICT Ax,  // input array, of type Atype
+    const GrB_Type Atype,           // type of Ax
+    const int64_t anz,              // size of Ax and Cx
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (Cx != NULL) ;
+    ASSERT (Ax != NULL) ;
+    ASSERT (scalar != NULL) ;
+    ASSERT (anz >= 0) ;
+    ASSERT (Atype != NULL) ;
+    ASSERT_BINARYOP_OK (op, "op for bind op", GB0) ;
+
+    //--------------------------------------------------------------------------
+    // determine the number of threads to use
+    //--------------------------------------------------------------------------
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int nthreads = GB_nthreads (anz, chunk, nthreads_max) ;
+
+    //--------------------------------------------------------------------------
+    // apply the operator with the bound scalar
+    //--------------------------------------------------------------------------
+
+    // the unbound operand of z = op(x,y) is y if the scalar is bound to x,
+    // and x otherwise
+    GrB_Type atype_required = bind_first ? op->ytype : op->xtype ;
+
+    size_t asize = Atype->size ;
+    size_t zsize = op->ztype->size ;
+    size_t awsize = atype_required->size ;
+    GxB_binary_function fop = op->function ;
+
+    int64_t p ;
+
+    if (Atype == atype_required)
+    {
+
+        // no typecasting of A is needed
+        if (bind_first)
+        {
+            #pragma omp parallel for num_threads(nthreads) schedule(static)
+            for (p = 0 ; p < anz ; p++)
+            {
+                // Cx [p] = fop (scalar, Ax [p])
+                fop (Cx +(p*zsize), scalar, Ax +(p*asize)) ;
+            }
+        }
+        else
+        {
+            #pragma omp parallel for num_threads(nthreads) schedule(static)
+            for (p = 0 ; p < anz ; p++)
+            {
+                // Cx [p] = fop (Ax [p], scalar)
+                fop (Cx +(p*zsize), Ax +(p*asize), scalar) ;
+            }
+        }
+
+    }
+    else
+    {
+
+        // typecast each entry of A into scalar workspace
+        GB_cast_function cast_A =
+            GB_cast_factory (atype_required->code, Atype->code) ;
+
+        if (bind_first)
+        {
+            #pragma omp parallel for num_threads(nthreads) schedule(static)
+            for (p = 0 ; p < anz ; p++)
+            {
+                // awork = (ytype) Ax [p]
+                GB_void awork [GB_VLA(awsize)] ;
+                cast_A (awork, Ax +(p*asize), asize) ;
+                // Cx [p] = fop (scalar, awork)
+                fop (Cx +(p*zsize), scalar, awork) ;
+            }
+        }
+        else
+        {
+            #pragma omp parallel for num_threads(nthreads) schedule(static)
+            for (p = 0 ; p < anz ; p++)
+            {
+                // awork = (xtype) Ax [p]
+                GB_void awork [GB_VLA(awsize)] ;
+                cast_A (awork, Ax +(p*asize), asize) ;
+                // Cx [p] = fop (awork, scalar)
+                fop (Cx +(p*zsize), awork, scalar) ;
+            }
+        }
+    }
+}
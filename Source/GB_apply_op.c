@@ -12,6 +12,14 @@
 // Cx and Ax may be aliased.
 // Compare with GB_transpose_op.c
 
+// FUTURE::: a batch ABI for user-defined operators: an alternative
+// registration that supplies a function operating on N contiguous entries
+// would let the generic paths here, in GB_AxB_saxpy3_generic.c, and in the
+// eWise workers call user code once per slice instead of once per entry, so
+// hand-vectorized user ops keep their lanes full.  It needs a new opcode
+// and a second function pointer in GB_UnaryOp_opaque/GB_BinaryOp_opaque,
+// with every generic worker split on which form is present.
+
 #include "GB_apply.h"
 #include "GB_unused.h"
 #ifndef GBCOMPACT
@@ -84,6 +84,37 @@
 // able to transplant S_work into T->x since the input will almost always be
 // unsorted.
 
+// FUTURE::: a "jumbled" matrix state that defers the within-vector sort:
+// reduce, apply, and the saxpy numeric accumulation do not need sorted
+// vectors, so the sort below could be skipped and performed on first
+// demand by a consumer that does (dot products, extract, binary search
+// paths).  The state is one flag plus a sort-on-demand choke point, but
+// every kernel that assumes sortedness must either declare or tolerate
+// it, which is what makes this a matrix-state change rather than a
+// builder option.
+
+// FUTURE::: NUMA-aware first touch: the final Ti/Tx arrays are faulted
+// by whichever threads first write them here, which need not match the
+// partition GB_pslice later hands to the compute kernels.  Aligning the
+// builder's parallel fill with the same static partitioning the kernels
+// use would make first-touch placement consistent on multi-socket
+// machines; an explicit interleave/bind policy needs libnuma and belongs
+// behind a GxB global option.
+
+// FUTURE::: a streaming build object with bounded memory: accept tuple
+// chunks, sort each chunk into a spilled sorted run, then k-way merge the
+// runs into the final matrix, keeping peak memory near the output size.
+// This is an out-of-core variant of the run-merge plan below and shares
+// its merge kernel.
+
+// FUTURE::: a parallel LSD radix sort for the tuple sort below, selected
+// by key width and tuple count.  The keys are (j,i) or (j,i,k) packed
+// int64s, so a radix path can reuse the same slicing; the msort is kept as
+// the general fallback.  Also: detect pre-sorted runs (sharded loaders
+// concatenate dozens of sorted partitions) and go straight to a multi-way
+// merge of the runs, skipping the sort phase entirely; the builder already
+// detects the fully-sorted case in one scan.
+
 #include "GB_build.h"
 #include "GB_sort.h"
 #ifndef GBCOMPACT
@@ -315,6 +346,13 @@ GrB_Info GB_builder                 // build a matrix from tuples
         else if (is_matrix)
         {
 
+            // FUTURE::: this scan could record the boundaries of ascending
+            // runs as it goes (a sharded loader concatenates dozens of
+            // sorted partitions); with the run boundaries known, the sort
+            // below could be replaced by a parallel multi-way merge of the
+            // runs, which is the dominant cost of such reloads.  The scan
+            // currently only distinguishes fully-sorted from unsorted.
+
             //------------------------------------------------------------------
             // C is a matrix; check both I_input and J_input
             //------------------------------------------------------------------
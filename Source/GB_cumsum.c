@@ -2,6 +2,15 @@
 // GB_cumsum: cumlative sum of an array
 //------------------------------------------------------------------------------
 
+// FUTURE::: pipelined count/fill phases: the two-phase operations (add,
+// emult, subref) sweep the same data twice with this cumsum and a barrier
+// between.  A pipelined mode would let slices stream through
+// count/offset/fill with only neighbor synchronization, trading the
+// global barrier for per-slice handoff; the offsets of slice k depend
+// only on the counts of slices 0..k-1, so a scan-based pipeline is
+// well-defined.  The templates would need their phase1/phase2 inclusion
+// merged, which is the bulk of the work.
+
 // SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
 // http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
 
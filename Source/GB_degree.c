@@ -0,0 +1,244 @@
+//------------------------------------------------------------------------------
+// GB_degree: compute the degree of each vector or each index of a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// Computes degree(k) = # of entries in the kth vector of A (if
+// vector_degree is true), or in the kth index of A (if false), as an INT64
+// GrB_Vector with one entry per non-empty vector or index.  The vector
+// degrees come straight from A->p (and A->h if hypersparse) in O(nvec)
+// time, with no pass over the entries at all.  The index degrees need one
+// pass over A->i: a histogram when the vector length is modest, or a
+// sort of a copy of A->i when the matrix is hypersparse with a huge
+// dimension, where a histogram of size vlen cannot be allocated.
+
+#include "GB.h"
+// FUTURE::: GxB_Matrix_stats could build on this: the empty-vector ratio
+// and min/mean/max degree come from the same O(nvec) pass over A->p, and
+// a degree histogram is one more pass over the degree vector; bandwidth
+// needs one pass over A->i.  See also GxB_Matrix_memoryUsage for the
+// capacity side of capacity planning.
+
+#include "GB_sort.h"
+#include "GB_atomics.h"
+
+#define GB_FREE_ALL                                 \
+{                                                   \
+    GB_FREE_MEMORY (W, wlen, sizeof (int64_t)) ;    \
+    GB_MATRIX_FREE (&T) ;                           \
+}
+
+GrB_Info GB_degree              // compute the degrees of a matrix
+(
+    GrB_Vector *degree,         // output: INT64 vector
+    const GrB_Matrix A,         // input matrix
+    const bool vector_degree,   // if true: degree of each vector of A,
+                                // else degree of each index of A
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (degree != NULL) ;
+    ASSERT_MATRIX_OK (A, "A for GB_degree", GB0) ;
+    ASSERT (!GB_PENDING (A)) ; ASSERT (!GB_ZOMBIES (A)) ;
+
+    (*degree) = NULL ;
+    GrB_Info info ;
+    GrB_Matrix T = NULL ;
+    int64_t *GB_RESTRICT W = NULL ;
+    int64_t wlen = 0 ;
+
+    int64_t anz = GB_NNZ (A) ;
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+
+    if (vector_degree)
+    {
+
+        //----------------------------------------------------------------------
+        // degree of each vector: read off A->p, in O(nvec) time
+        //----------------------------------------------------------------------
+
+        int64_t n = A->vdim ;
+        int64_t anvec = A->nvec ;
+        const int64_t *GB_RESTRICT Ap = A->p ;
+        const int64_t *GB_RESTRICT Ah = A->h ;
+
+        // count the non-empty vectors
+        int nth = GB_nthreads (anvec, chunk, nthreads_max) ;
+        int64_t k, nv = 0 ;
+        #pragma omp parallel for num_threads(nth) schedule(static) \
+            reduction(+:nv)
+        for (k = 0 ; k < anvec ; k++)
+        {
+            if (Ap [k+1] > Ap [k]) nv++ ;
+        }
+
+        GB_CREATE (&T, GrB_INT64, n, 1, GB_Ap_malloc, true,
+            GB_FORCE_NONHYPER, GB_HYPER_DEFAULT, 1, GB_IMAX (nv, 1), true,
+            Context) ;
+        if (info != GrB_SUCCESS)
+        {
+            return (info) ;
+        }
+        T->p [0] = 0 ;
+        T->p [1] = nv ;
+        T->nvec_nonempty = (nv > 0) ? 1 : 0 ;
+        T->magic = GB_MAGIC ;
+
+        int64_t *GB_RESTRICT Ti = T->i ;
+        int64_t *GB_RESTRICT Tx = T->x ;
+        int64_t p = 0 ;
+        for (k = 0 ; k < anvec ; k++)
+        {
+            int64_t d = Ap [k+1] - Ap [k] ;
+            if (d > 0)
+            {
+                Ti [p] = (Ah == NULL) ? k : Ah [k] ;
+                Tx [p] = d ;
+                p++ ;
+            }
+        }
+
+    }
+    else
+    {
+
+        //----------------------------------------------------------------------
+        // degree of each index: one pass over A->i
+        //----------------------------------------------------------------------
+
+        int64_t n = A->vlen ;
+        const int64_t *GB_RESTRICT Ai = A->i ;
+        int64_t nv = 0 ;
+
+        if (n <= 16 * (anz + 1))
+        {
+
+            //------------------------------------------------------------------
+            // histogram over the indices
+            //------------------------------------------------------------------
+
+            wlen = GB_IMAX (n, 1) ;
+            GB_CALLOC_MEMORY (W, wlen, sizeof (int64_t)) ;
+            if (W == NULL)
+            {
+                return (GB_OUT_OF_MEMORY) ;
+            }
+
+            int nth = GB_nthreads (anz, chunk, nthreads_max) ;
+            int64_t p ;
+            #pragma omp parallel for num_threads(nth) schedule(static)
+            for (p = 0 ; p < anz ; p++)
+            {
+                GB_ATOMIC_UPDATE
+                W [Ai [p]]++ ;
+            }
+
+            int64_t i ;
+            #pragma omp parallel for num_threads(nth) schedule(static) \
+                reduction(+:nv)
+            for (i = 0 ; i < n ; i++)
+            {
+                if (W [i] > 0) nv++ ;
+            }
+
+            GB_CREATE (&T, GrB_INT64, n, 1, GB_Ap_malloc, true,
+                GB_FORCE_NONHYPER, GB_HYPER_DEFAULT, 1, GB_IMAX (nv, 1),
+                true, Context) ;
+            if (info != GrB_SUCCESS)
+            {
+                GB_FREE_ALL ;
+                return (info) ;
+            }
+            T->p [0] = 0 ;
+            T->p [1] = nv ;
+            T->nvec_nonempty = (nv > 0) ? 1 : 0 ;
+            T->magic = GB_MAGIC ;
+
+            int64_t *GB_RESTRICT Ti = T->i ;
+            int64_t *GB_RESTRICT Tx = T->x ;
+            int64_t p2 = 0 ;
+            for (i = 0 ; i < n ; i++)
+            {
+                if (W [i] > 0)
+                {
+                    Ti [p2] = i ;
+                    Tx [p2] = W [i] ;
+                    p2++ ;
+                }
+            }
+            GB_FREE_MEMORY (W, wlen, sizeof (int64_t)) ;
+
+        }
+        else
+        {
+
+            //------------------------------------------------------------------
+            // huge dimension (hypersparse): sort a copy of the indices
+            //------------------------------------------------------------------
+
+            wlen = GB_IMAX (anz, 1) ;
+            GB_MALLOC_MEMORY (W, wlen, sizeof (int64_t)) ;
+            if (W == NULL)
+            {
+                return (GB_OUT_OF_MEMORY) ;
+            }
+            GB_memcpy (W, Ai, anz * sizeof (int64_t),
+                GB_nthreads (anz, chunk, nthreads_max)) ;
+            GB_qsort_1a (W, anz) ;
+
+            // count the runs
+            for (int64_t p = 0 ; p < anz ; p++)
+            {
+                if (p == 0 || W [p] != W [p-1]) nv++ ;
+            }
+
+            GB_CREATE (&T, GrB_INT64, n, 1, GB_Ap_malloc, true,
+                GB_FORCE_NONHYPER, GB_HYPER_DEFAULT, 1, GB_IMAX (nv, 1),
+                true, Context) ;
+            if (info != GrB_SUCCESS)
+            {
+                GB_FREE_ALL ;
+                return (info) ;
+            }
+            T->p [0] = 0 ;
+            T->p [1] = nv ;
+            T->nvec_nonempty = (nv > 0) ? 1 : 0 ;
+            T->magic = GB_MAGIC ;
+
+            int64_t *GB_RESTRICT Ti = T->i ;
+            int64_t *GB_RESTRICT Tx = T->x ;
+            int64_t p2 = -1 ;
+            for (int64_t p = 0 ; p < anz ; p++)
+            {
+                if (p == 0 || W [p] != W [p-1])
+                {
+                    p2++ ;
+                    Ti [p2] = W [p] ;
+                    Tx [p2] = 1 ;
+                }
+                else
+                {
+                    Tx [p2]++ ;
+                }
+            }
+            GB_FREE_MEMORY (W, wlen, sizeof (int64_t)) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    ASSERT_MATRIX_OK (T, "T = degree (A)", GB0) ;
+    (*degree) = (GrB_Vector) T ;
+    return (GrB_SUCCESS) ;
+}
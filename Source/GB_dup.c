@@ -27,6 +27,21 @@
 
 // A is the new copy and B is the old copy.  Each should be freed when done.
 
+// FUTURE::: snapshot isolation builds directly on copy-on-write below:
+// readers acquire a refcounted snapshot (a COW dup), the writer mutates
+// the primary whose components unshare on first write, and snapshots
+// free their shares on release.  No stop-the-world is needed once COW
+// exists; the snapshot API is just dup plus documented lifetime rules.
+
+// FUTURE::: copy-on-write duplication: sharing p/h/i/x between the
+// original and the duplicate needs a reference count on each component
+// array and an unshare step in every mutating path (setElement, assign,
+// zombie marking, GB_wait assembly, GB_ix_realloc).  The shallow-copy
+// machinery (GB_shallow_copy, p_shallow/h_shallow/i_shallow/x_shallow)
+// is the intra-operation version of this and shows where the unshare
+// hooks belong; the missing piece is the refcount, since a shallow copy
+// today must not outlive its parent.
+
 #include "GB.h"
 
 GrB_Info GB_dup             // make an exact copy of a matrix
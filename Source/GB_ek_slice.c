@@ -38,20 +38,22 @@ bool GB_ek_slice        // true if successful, false if out of memory
     (*kfirst_slice_handle) = NULL ;
     (*klast_slice_handle ) = NULL ;
 
+    // all three arrays are allocated as a single block of memory, of size
+    // 3*ntasks+1, owned by pstart_slice and freed by GB_ek_slice_free
     int64_t *GB_RESTRICT pstart_slice = NULL ;
     int64_t *GB_RESTRICT kfirst_slice = NULL ;
     int64_t *GB_RESTRICT klast_slice  = NULL ;
 
-    GB_CALLOC_MEMORY (pstart_slice, ntasks+1, sizeof (int64_t)) ;
-    GB_CALLOC_MEMORY (kfirst_slice, ntasks, sizeof (int64_t)) ;
-    GB_CALLOC_MEMORY (klast_slice, ntasks, sizeof (int64_t)) ;
+    GB_CALLOC_MEMORY (pstart_slice, 3*ntasks+1, sizeof (int64_t)) ;
 
-    if (pstart_slice == NULL || kfirst_slice == NULL || klast_slice == NULL)
-    { 
-        GB_ek_slice_free (&pstart_slice, &kfirst_slice, &klast_slice, ntasks) ;
+    if (pstart_slice == NULL)
+    {
         return (false) ;
     }
 
+    kfirst_slice = pstart_slice + (ntasks+1) ;
+    klast_slice  = kfirst_slice + ntasks ;
+
     (*pstart_slice_handle) = pstart_slice ;
     (*kfirst_slice_handle) = kfirst_slice ;
     (*klast_slice_handle ) = klast_slice ;
@@ -16,9 +16,12 @@ void GB_ek_slice_free
     int64_t *GB_RESTRICT *klast_slice_handle,  // size ntasks
     int ntasks                              // # of tasks
 )
-{ 
-    GB_FREE_MEMORY ((*pstart_slice_handle), ntasks+1, sizeof (int64_t)) ;
-    GB_FREE_MEMORY ((*kfirst_slice_handle), ntasks, sizeof (int64_t)) ;
-    GB_FREE_MEMORY ((*klast_slice_handle), ntasks, sizeof (int64_t)) ;
+{
+    // all three arrays are one block of memory, of size 3*ntasks+1, owned by
+    // pstart_slice (see GB_ek_slice); kfirst_slice and klast_slice point
+    // into that block and are not freed on their own
+    GB_FREE_MEMORY ((*pstart_slice_handle), 3*ntasks+1, sizeof (int64_t)) ;
+    (*kfirst_slice_handle) = NULL ;
+    (*klast_slice_handle) = NULL ;
 }
 
@@ -159,7 +159,7 @@ GrB_Info GB_emult_phase2                // C=A.*B or C<M>=A.*B
         GB_Opcode opcode ;
         GB_Type_code xycode, zcode ;
 
-        if (GB_binop_builtin (A->type, A_is_pattern, B->type, A_is_pattern, op,
+        if (GB_binop_builtin (A->type, A_is_pattern, B->type, B_is_pattern, op,
             false, &opcode, &xycode, &zcode) && ccode == zcode)
         { 
             #include "GB_binop_factory.c"
@@ -30,7 +30,7 @@ GrB_Info GB_ewise                   // C<M> = accum (C, A+B) or A.*B
 (
     GrB_Matrix C,                   // input/output matrix for results
     const bool C_replace,           // if true, clear C before writing to it
-    const GrB_Matrix M,             // optional mask for C, unused if NULL
+    const GrB_Matrix M_input,       // optional mask for C, unused if NULL
     const bool Mask_comp,           // if true, complement the mask M
     const bool Mask_struct,         // if true, use the only structure of M
     const GrB_BinaryOp accum,       // optional accum for Z=accum(C,T)
@@ -41,6 +41,8 @@ GrB_Info GB_ewise                   // C<M> = accum (C, A+B) or A.*B
     bool B_transpose,               // if true, use B' instead of B
     bool eWiseAdd,                  // if true, do set union (like A+B),
                                     // otherwise do intersection (like A.*B)
+    const GB_void *alpha,           // for eWiseUnion, or NULL (see GB_ewise.h)
+    const GB_void *beta,            // for eWiseUnion, or NULL
     GB_Context Context
 )
 {
@@ -52,6 +54,7 @@ GrB_Info GB_ewise                   // C<M> = accum (C, A+B) or A.*B
     // C may be aliased with M, A, and/or B
 
     GrB_Info info ;
+    GrB_Matrix M = M_input ;        // use the mask M, until deciding otherwise
     GrB_Matrix MT = NULL, BT = NULL, AT = NULL, T = NULL ;
 
     GB_RETURN_IF_FAULTY (accum) ;
@@ -165,6 +168,21 @@ GrB_Info GB_ewise                   // C<M> = accum (C, A+B) or A.*B
     if (B_is_dense) { GBBURBLE ("(B dense) ") ; }
     if (M_is_dense) { GBBURBLE ("(M dense) ") ; }
 
+    //--------------------------------------------------------------------------
+    // discard an all-true mask
+    //--------------------------------------------------------------------------
+
+    // A dense structural mask that is not complemented is all true, so
+    // C<M>=Z and C<M,replace>=Z are identical to C=Z.  Discard the mask, so
+    // that the dense special cases below can apply, and so that GB_add,
+    // GB_emult, and GB_accum_mask do not examine the mask at all.
+
+    if (M != NULL && !Mask_comp && Mask_struct && M_is_dense)
+    {
+        GBBURBLE ("(mask is all true: discard) ") ;
+        M = NULL ;
+    }
+
     //--------------------------------------------------------------------------
     // decide when to apply the mask
     //--------------------------------------------------------------------------
@@ -246,6 +264,14 @@ GrB_Info GB_ewise                   // C<M> = accum (C, A+B) or A.*B
     // special cases
     //--------------------------------------------------------------------------
 
+    // The all-dense ewise3 kernels below handle only the case where A, B
+    // (and C, for the accum form) are all dense.  The mixed dense/sparse
+    // shapes do not need kernels of their own here: GB_add and GB_emult
+    // special-case density per vector (dense+sparse union with no merge,
+    // direct lookup instead of binary search in the intersection), and a
+    // dense C += sparse T lands on GB_dense_subassign_23 via
+    // GB_accum_mask/GB_subassigner, updating C in place without a rebuild.
+
     // FUTURE::: handle more special cases
 
     if (A_is_dense && B_is_dense)
@@ -322,7 +348,7 @@ GrB_Info GB_ewise                   // C<M> = accum (C, A+B) or A.*B
     if (eWiseAdd)
     { 
         GB_OK (GB_add (&T, T_type, C_is_csc, M1, Mask_struct, A1, B1, op,
-            Context)) ;
+            alpha, beta, Context)) ;
     }
     else
     { 
@@ -26,6 +26,12 @@ GrB_Info GB_ewise                   // C<M> = accum (C, A+B) or A.*B
     bool B_transpose,               // if true, use B' instead of B
     bool eWiseAdd,                  // if true, do set union (like A+B),
                                     // otherwise do intersection (like A.*B)
+    const GB_void *alpha,           // for eWiseUnion: replaces A(i,j) when
+                                    // only B(i,j) is present; typecast to
+                                    // op->xtype.  NULL for eWiseAdd/Mult
+    const GB_void *beta,            // for eWiseUnion: replaces B(i,j) when
+                                    // only A(i,j) is present; typecast to
+                                    // op->ytype.  NULL for eWiseAdd/Mult
     GB_Context Context
 ) ;
 
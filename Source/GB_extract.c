@@ -19,6 +19,12 @@
 
 // C<M> = accum (C, A(Cols,Rows)')
 
+// FUTURE::: accept a boolean GrB_Vector directly as the row/column
+// selector, walking the mask's pattern as the (already sorted) index
+// list.  Today the idiom is extractTuples on the mask followed by
+// GrB_extract on the resulting list; a vector-selector overload would
+// skip that materialization and feed GB_subref's slicing directly.
+
 #include "GB_extract.h"
 #include "GB_subref.h"
 #include "GB_accum_mask.h"
@@ -14,6 +14,13 @@
 // Returns GrB_SUCCESS if A(row,col) is present, and sets x to its value.
 // Returns GrB_NO_VALUE if A(row,col) is not present, and x is unmodified.
 
+// FUTURE::: a point-query accelerator: each extractElement pays a
+// GB_lookup plus a binary search.  A per-matrix cached accelerator
+// (row-offset table plus hashed column index) would make hot serving
+// queries O(1); like the hyperlist hash (see GB_lookup in GB.h) it is a
+// disposable cached structure, freed on any pattern change, gated on the
+// pattern-version counter.
+
 #include "GB.h"
 
 GrB_Info GB_extractElement      // extract a single entry, x = A(row,col)
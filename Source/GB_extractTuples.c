@@ -19,6 +19,18 @@
 // This function is not user-callable.  It does the work for the user-callable
 // GrB_*_extractTuples functions.
 
+// Note: all three output arrays are individually optional: passing NULL
+// for I (or J, or X) skips that component entirely, so a vector export
+// that needs only the values already pays nothing for the index array --
+// GrB_Vector_extractTuples (NULL, X, &n, v) is the supported idiom.
+
+// FUTURE::: chunked extraction: this interface demands three full-size
+// caller arrays.  A cursor API (extract entries [k, k+len) in vector
+// order into caller buffers, returning the next position) falls out of
+// the same loops with a start/length parameter and would let exporters
+// stream a 40GB matrix through a fixed window; the public iterator
+// (see GB_iterator.h) is the entry-at-a-time form of the same need.
+
 #include "GB.h"
 
 GrB_Info GB_extractTuples       // extract all tuples from a matrix
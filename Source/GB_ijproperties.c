@@ -57,6 +57,13 @@ GrB_Info GB_ijproperties        // check I and determine its properties
     // Icolon: begin:inc:end for all but GB_LIST
 
     // outputs:
+    // Note that sorted inputs are never re-sorted: this analysis detects
+    // ascending order with one parallel scan, and GB_ijsort runs only when
+    // the list is actually out of order.  A descriptor contract asserting
+    // "sorted and duplicate-free" could skip even this scan, but it would
+    // turn a caller's mistake into silent wrong answers or out-of-bounds
+    // reads in the kernels, so the scan is kept as the safe default.
+
     // I_is_unsorted: true if Ikind == GB_LIST and not in ascending order
     // I_is_contig: true if I has the form I = begin:end
     // imin, imax: min (I) and max (I), but only including actual indices
@@ -24,6 +24,21 @@
 // GxB_init is the same as GrB_init except that it also defines the
 // malloc/calloc/realloc/free functions to use.
 
+// FUTURE::: a persistent plan cache ties the calibration below to the
+// decision-log idea (see GB_AxB_meta.c): persist tuned constants and
+// method choices keyed by (operation, type, shape bucket, sparsity
+// bucket) across sessions, loaded here at init.  Cache poisoning across
+// library versions is the main hazard, so entries must be keyed by
+// version and invalidated wholesale on upgrade.
+
+// FUTURE::: calibrated defaults: the global chunk size (GxB_CHUNK, 64K)
+// governs all GB_nthreads decisions yet is a fixed constant, wrong on both
+// small-core and large-cache machines.  An optional calibration pass --
+// benchmark a memcpy-bound and a compute-bound loop at init, derive chunk
+// and a parallelism threshold, persist via GxB_Global_Option_get/set --
+// would replace per-deployment hand tuning.  It must stay opt-in:
+// GrB_init is specified to be cheap.
+
 #include "GB_thread_local.h"
 
 //------------------------------------------------------------------------------
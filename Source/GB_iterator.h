@@ -7,6 +7,14 @@
 
 //------------------------------------------------------------------------------
 
+// FUTURE::: a public seekable iterator (a GxB_Iterator) over finished
+// matrices would expose this machinery so applications can stream entries
+// without the three full-size arrays of extractTuples.  The internal
+// iterators assume no zombies or pending tuples; a public version must
+// force completion on attach and pin the matrix read-only for its
+// lifetime, which is the same read-only state the mmap-backed matrices
+// need (see GxB_Matrix_import_CSR.c).
+
 #ifndef GB_ITERATOR_H
 #define GB_ITERATOR_H
 #include "GB.h"
@@ -46,7 +46,7 @@ GrB_Info GB_ix_resize           // resize a matrix
         // 50% for future growth, if possible.  Do not increase the size beyond
         // the existing space, however.
 
-        int64_t anzmax_new = GB_IMAX (anzmax_orig, anz_new + (anz_new/2)) ;
+        int64_t anzmax_new = GB_IMIN (anzmax_orig, anz_new + (anz_new/2)) ;
 
         // since the space is shrinking, this is guaranteed not to fail
         ASSERT (anzmax_new <= anzmax_orig) ;
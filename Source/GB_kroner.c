@@ -22,6 +22,14 @@
 // FUTURE: each vector C(:,k) takes O(nnz(C(:,k))) work, but this is not
 // accounted for in the parallel load-balancing.
 
+// FUTURE::: a lazy Kronecker operator view, usable as the A argument of
+// GrB_mxm so that kron(G,G)*x is computed without materializing kron(G,G),
+// would need an operand abstraction in the kernels; the kernels all read
+// Ap/Ai/Ax directly.  Until then, the memory-bound scale-up cases should
+// stream output blocks: kron(A,B) restricted to a block row/column of C is
+// kron applied to submatrices of A and B, so callers can tile with
+// GrB_extract at no asymptotic cost.
+
 #include "GB_kron.h"
 
 GrB_Info GB_kroner                  // C = kron (A,B)
@@ -175,7 +183,7 @@ GrB_Info GB_kroner                  // C = kron (A,B)
         // get B(:,jB), the (kB)th vector of B
         int64_t pB_start = Bp [kB] ;
         int64_t pB_end   = Bp [kB+1] ;
-        int64_t bknz = pB_start - pB_end ;
+        int64_t bknz = pB_end - pB_start ;
         if (bknz == 0) continue ;
         GB_void bwork [GB_VLA(bsize)] ;
 
@@ -19,6 +19,48 @@
 // to turn on memory usage debug printing, uncomment this line:
 // #define GB_PRINT_MALLOC 1
 
+// FUTURE::: transparent huge pages: arrays above a threshold could be
+// backed by 2MB pages via madvise(MADV_HUGEPAGE) after allocation, which
+// composes with any user-registered malloc since it needs only the
+// pointer and size here.  Explicit hugetlb mounts or mmap flags would
+// bypass the registered allocator and are out of bounds; madvise is the
+// portable middle ground, behind a GxB global option with a size
+// threshold.
+
+// FUTURE::: pinned (page-locked) host allocation for transfer staging
+// shares the same contract problem as alignment below: cudaHostAlloc
+// bypasses the user-registered malloc.  A per-matrix staging flag that
+// pins existing allocations with cudaHostRegister avoids the allocator
+// conflict and gets full DMA bandwidth for the host/device split.
+
+// FUTURE::: 64-byte aligned, vector-width-padded value arrays: aligned
+// loads and the removal of per-vector scalar epilogues need allocation
+// through posix_memalign (or over-allocate and align), which conflicts
+// with the user-registered malloc/realloc contract -- realloc cannot
+// preserve alignment.  Padding nzmax up to a vector width is the easy
+// half and can be done today in GB_ix_realloc; the alignment half needs
+// an allocator contract change at GxB_init.
+
+// FUTURE::: a size-classed free pool in front of the registered malloc
+// (per-thread caches with high-water trimming) would relieve allocator
+// arena contention under multi-threaded query loads.  Two constraints
+// shape it: all memory must still originate from the user-registered
+// malloc (GxB_init lets applications supply their own), and per-thread
+// caches cannot be reclaimed at GrB_finalize under the supported user
+// threading models, so the pool must be global with striped locks or
+// bounded per-thread slabs that are registered centrally.  The stack
+// workspace in saxpy3 and the coalesced ek_slice blocks already removed
+// the hottest small allocations (see also the arena note below).
+
+// FUTURE::: a per-operation arena (one bump allocation at entry, one
+// release at exit) suits the kernels whose workspace sizes are known
+// after the analysis phase; saxpy3 already coalesces its hash tables
+// into three blocks and its task arrays into stack space, which is the
+// same idea applied piecewise.  A general arena needs an owner to thread
+// through the call tree -- GB_Context is the natural carrier, since every
+// internal function already receives it -- and error paths must release
+// the whole arena instead of unwinding individual frees.
+
 #include "GB.h"
 
 GB_PUBLIC   // accessed by the MATLAB tests in GraphBLAS/Test only
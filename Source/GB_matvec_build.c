@@ -12,6 +12,13 @@
 
 // This function implements GrB_Matrix_build_* and GrB_Vector_build_*.
 
+// FUTURE::: a zero-copy build adopting the caller's I/J/X arrays, in the
+// style of GxB_Matrix_import_CSR.  GB_builder can already consume and free
+// caller-side workspace through its *_work_handle arguments, but adopted
+// arrays must have been allocated with the malloc registered via GxB_init,
+// since the builder frees or reallocs them with the library allocator; a
+// public variant therefore needs that contract spelled out, as import does.
+
 #include "GB_build.h"
 
 GrB_Info GB_matvec_build        // check inputs then build matrix or vector
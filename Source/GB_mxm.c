@@ -12,6 +12,23 @@
 // This function is not user-callable.  It does the work for user-callable
 // functions GrB_mxm, GrB_mxv, and GrB_vxm.
 
+// FUTURE::: output preallocation hints: iterative algorithms rebuild C
+// every call though its size barely changes.  A descriptor hint could
+// make this function reuse C's existing arrays when the new result fits
+// (the transplant path would copy into them instead of swapping
+// pointers), turning the free/alloc pair into a no-op in steady state.
+// The never-shrinking capacity bug is fixed (GB_ix_resize), so reuse
+// plus GxB_Matrix_fit covers both directions of the capacity problem.
+
+// FUTURE::: fused C=f(A)*B: applying a unary op to the entries of A (or B)
+// on the fly would drop the materialized GrB_apply temporary for workloads
+// like spones and log-weighted multiplies.  The generic workers could fuse
+// the op into GB_GETA/GB_GETB today, but the builtin kernels would need
+// unaryop-specialized factory expansions, and there is no entry point in the
+// GrB_mxm signature to carry the op.  Note that spones(A)*B needs no fusion
+// at all: the PAIR multiplier and the pattern-only A_is_pattern paths
+// already never read A->x.
+
 #include "GB_mxm.h"
 #include "GB_accum_mask.h"
 
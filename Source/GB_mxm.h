@@ -201,6 +201,18 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
     GB_Context Context
 ) ;
 
+GrB_Info GB_AxB_gemm                // C = A*B via external BLAS, if possible
+(
+    GrB_Matrix *Chandle,            // output matrix
+    const GrB_Matrix A,             // input matrix A
+    const GrB_Matrix B,             // input matrix B
+    const GrB_Semiring semiring,    // semiring that defines C=A*B
+    const bool atrans,              // if true, compute C=A'*B
+    const bool btrans,              // if true, compute C=A*B'
+    bool *done,                     // if true, C=A*B was computed here
+    GB_Context Context
+) ;
+
 GrB_Info GB_AxB_dot4                // C+=A'*B, dot product method
 (
     GrB_Matrix C,                   // input/output matrix, must be dense
@@ -35,6 +35,13 @@
 // grep "allocate a new header"
 // which shows all uses of GB_new and GB_create
 
+// FUTURE::: small-object optimization: below a size threshold the header,
+// p, i, and x could live in one allocation, eliminating three of the four
+// mallocs for the millions of tiny vectors some workloads create.  The
+// blockers are the paths that free or realloc components independently
+// (GB_ix_realloc, GB_ix_free, transplant, import/export adoption), which
+// would all need to distinguish inline from owned storage.
+
 #include "GB.h"
 
 GB_PUBLIC   // accessed by the MATLAB tests in GraphBLAS/Test only
@@ -2,6 +2,21 @@
 // GB_pslice: partition Ap for a parallel loop
 //------------------------------------------------------------------------------
 
+// FUTURE::: small-operation fast path: below a work threshold the task
+// machinery, flop analysis, and workspace allocation dwarf the math.
+// The pieces landed so far (stack task lists in saxpy3, coalesced
+// ek_slice workspace, single-task shortcuts) cut the allocations, but a
+// true fast path would recognize tiny work at the top of each operation
+// and run one fused serial loop; the nthreads decision here is where
+// that threshold already lives.
+
+// FUTURE::: topology-aware slicing: task boundaries here are chosen by
+// entry counts alone.  Aligning them with the NUMA placement of the
+// underlying pages (and optionally pinning workers to sockets) depends on
+// the placement API and first-touch alignment noted in GB_builder.c; the
+// slicing itself would then take a page-ownership map instead of assuming
+// uniform access cost.
+
 // SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
 // http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
 
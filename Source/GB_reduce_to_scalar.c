@@ -13,6 +13,18 @@
 // This function does not need to know if A is hypersparse or not, and its
 // result is the same if A is in CSR or CSC format.
 
+// FUTURE::: masked reduce (sum of entries under a mask M) is a special
+// case of the fused eWiseMult+reduce below with M as the second
+// operand and a structural multiplier, so one fused entry point covers
+// both; the intermediate it removes is proportional to the region.
+
+// FUTURE::: fused eWiseMult+reduce, s = reduce(A.*B): the emult
+// intersection loop could feed the panel reduction here directly and never
+// materialize the intersection matrix, but this function only sees the
+// already-computed matrix; the fusion needs either a fused GxB entry point
+// or a deferred-execution layer (see also the note in
+// GB_reduce_to_vector.c on reduce(A*B)).
+
 #include "GB_reduce.h"
 #include "GB_atomics.h"
 #ifndef GBCOMPACT
@@ -12,6 +12,21 @@
 // C<M> = accum (C,reduce(A)) where C is n-by-1.  Reduces a matrix A or A'
 // to a vector.
 
+// FUTURE::: argmin/argmax per row or column (value vector plus index
+// vector in one pass).  The clean fit is index-carrying accumulation: a
+// (value,index) pair type with a MIN/MAX-by-value monoid, reduced here
+// like any row reduce.  With positional multiply ops (see the note in
+// GB_AxB_factory.c) this falls out of existing machinery as a user-defined
+// monoid over a pair type; a built-in needs that pair type first.
+
+// FUTURE::: fused mxm+reduce, r = reduce(A*B): the saxpy3 numeric phase
+// could feed the monoid directly and never materialize A*B, but this
+// function only sees the already-computed matrix, so the fusion needs a
+// deferred-execution layer above the operations.  When the multiplier
+// distributes over the monoid (e.g. PLUS_TIMES), no fusion is needed at
+// all: reduce each row of A*B as A*(B*ones) with two mxv calls, which is
+// cheaper than any fused kernel since A*B is never formed even implicitly.
+
 #include "GB_reduce.h"
 #include "GB_build.h"
 #include "GB_ek_slice.h"
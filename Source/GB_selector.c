@@ -7,6 +7,35 @@
 
 //------------------------------------------------------------------------------
 
+// FUTURE::: select-to-callback: streaming qualifying entries to a
+// caller callback instead of materializing the selected matrix reuses
+// the phase1 counts for per-task offsets and invokes the callback per
+// chunk; it shares the cursor design of the chunked extractTuples note
+// (GB_extractTuples.c) and the same re-entrancy caveats as the APM
+// callbacks (GB_Global.c).
+
+// FUTURE::: fused select+apply (filter then transform in one pass): the
+// phase2 copy loops below could apply a unary op while gathering the
+// kept entries, eliminating the intermediate matrix of a select-then-
+// apply pipeline.  The entry point needs both operators; within the
+// kernels it is one extra macro in the copy path, like the eWiseUnion
+// fills in GB_add_phase2.
+
+// FUTURE::: delta-stepping SSSP would be built on this selector: the
+// active bucket is a GxB_select over tentative distances, relaxations
+// are masked min-plus vxm over the bucket, and reinsertions ride
+// assign.  A supported routine needs per-bucket frontier bookkeeping and
+// a delta heuristic from the degree/weight statistics; all the kernels
+// exist.
+
+// FUTURE::: k-core decomposition similarly composes select and mxv, but
+// the peeling loop should maintain degrees incrementally (subtracting
+// the degrees of peeled vertices via masked mxv) instead of recomputing
+// the degree vector each round; GxB_Matrix_rowDegree provides the
+// initial vector in O(nvec).  Incremental maintenance makes each peel
+// O(edges touched) instead of O(nnz), which is the entire speedup of a
+// library k-core over the naive loop.
+
 #include "GB_select.h"
 #include "GB_ek_slice.h"
 #include "GB_sel__include.h"
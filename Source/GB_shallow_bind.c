@@ -0,0 +1,130 @@
+//------------------------------------------------------------------------------
+// GB_shallow_bind: create a shallow copy and apply a binary op with a scalar
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// C = op (scalar, A) or C = op (A, scalar), with the scalar bound to the x or
+// y operand of the binary operator.  The pattern of C is a shallow copy of
+// the pattern of A.  The values of C are always newly allocated, of type
+// op->ztype.  Compare with GB_shallow_op.c, which does the same for a unary
+// operator.
+
+#include "GB_apply.h"
+
+GrB_Info GB_shallow_bind    // create shallow matrix, apply bound binary op
+(
+    GrB_Matrix *Chandle,    // output matrix C, of type op->ztype
+    const bool C_is_csc,    // desired CSR/CSC format of C
+    const GrB_BinaryOp op,  // operator to apply
+    const GB_void *scalar,  // typecast to op->xtype or op->ytype
+    const bool bind_first,  // if true, C = op (scalar, A), else op (A, scalar)
+    const GrB_Matrix A,     // input matrix
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (Chandle != NULL) ;
+    ASSERT_MATRIX_OK (A, "A for shallow_bind", GB0) ;
+    ASSERT_BINARYOP_OK (op, "op for shallow_bind", GB0) ;
+    ASSERT (scalar != NULL) ;
+    ASSERT (GB_Type_compatible (bind_first ? op->ytype : op->xtype, A->type)) ;
+    ASSERT ((A->nzmax == 0) == (A->i == NULL && A->x == NULL)) ;
+    ASSERT (!GB_PENDING (A)) ; ASSERT (!GB_ZOMBIES (A)) ;
+
+    (*Chandle) = NULL ;
+
+    //--------------------------------------------------------------------------
+    // construct a shallow copy of A for the pattern of C
+    //--------------------------------------------------------------------------
+
+    // allocate the struct for C, but do not allocate C->h, C->p, C->i, or C->x.
+    // C has the exact same hypersparsity as A.
+    GrB_Info info ;
+    GrB_Matrix C = NULL ;           // allocate a new header for C
+    GB_NEW (&C, op->ztype, A->vlen, A->vdim, GB_Ap_null, C_is_csc,
+        GB_SAME_HYPER_AS (A->is_hyper), A->hyper_ratio, 0, Context) ;
+    if (info != GrB_SUCCESS)
+    {
+        // out of memory
+        return (info) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // make a shallow copy of the vector pointers
+    //--------------------------------------------------------------------------
+
+    ASSERT (C->magic == GB_MAGIC2) ;   // [ be careful; C not yet initialized
+    C->p_shallow = true ;           // C->p not freed when freeing C
+    C->h_shallow = true ;           // C->h not freed when freeing C
+    C->p = A->p ;                   // C->p is of size A->plen + 1
+    C->h = A->h ;                   // C->h is of size A->plen
+    C->plen = A->plen ;             // C and A have the same hyperlist sizes
+    C->nvec = A->nvec ;
+    C->nvec_nonempty = A->nvec_nonempty ;
+    C->magic = GB_MAGIC ;           // C is now initialized ]
+
+    //--------------------------------------------------------------------------
+    // check for empty matrix
+    //--------------------------------------------------------------------------
+
+    if (A->nzmax == 0)
+    {
+        // C->p and C->h are shallow but the rest is empty
+        C->nzmax = 0 ;
+        C->i = NULL ;
+        C->x = NULL ;
+        C->i_shallow = false ;
+        C->x_shallow = false ;
+        ASSERT_MATRIX_OK (C, "C = quick copy of empty A", GB0) ;
+        (*Chandle) = C ;
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // make a shallow copy of the pattern
+    //--------------------------------------------------------------------------
+
+    C->i = A->i ;               // of size A->nzmax
+    C->i_shallow = true ;       // C->i will not be freed when freeing C
+
+    //--------------------------------------------------------------------------
+    // allocate new space for the numerical values of C
+    //--------------------------------------------------------------------------
+
+    int64_t anz = GB_NNZ (A) ;
+    ASSERT (A->nzmax >= GB_IMAX (anz,1)) ;
+
+    C->nzmax = GB_IMAX (anz,1) ;
+    GB_MALLOC_MEMORY (C->x, C->nzmax, C->type->size) ;
+    C->x_shallow = false ;          // free C->x when freeing C
+    if (C->x == NULL)
+    {
+        // out of memory
+        GB_MATRIX_FREE (&C) ;
+        return (GB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // apply the binary operator with the bound scalar
+    //--------------------------------------------------------------------------
+
+    // C->x = op (scalar, Ax) or op (Ax, scalar)
+    GB_apply_bind_op (C->x, op, scalar, bind_first, A->x, A->type, anz,
+        Context) ;
+
+    //--------------------------------------------------------------------------
+    // return the result
+    //--------------------------------------------------------------------------
+
+    ASSERT_MATRIX_OK (C, "C = shallow_bind (op, scalar, A)", GB0) ;
+    (*Chandle) = C ;
+    return (GrB_SUCCESS) ;
+}
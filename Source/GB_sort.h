@@ -12,6 +12,20 @@
 // guaranteed to be stable, but they are always used in GraphBLAS with unique
 // keys.
 
+// FUTURE::: GxB_Matrix_sort (order each row or column by value) and a
+// fused top-k truncation.  Per-vector sorts fit the slicing used by the
+// builder msorts (one task per vector above a size cutoff, batches of
+// small vectors otherwise); the output is a permuted-value matrix plus an
+// optional index matrix.  Top-k is a partial sort per vector and avoids
+// materializing the full ordering.
+
+// FUTURE::: a task-parallel in-place quicksort, used wherever the serial
+// GB_qsort_* routines sort large slices on one core (GB_ijsort, the
+// selector workspace, subref), and as the low-memory alternative to
+// GB_msort_* which needs a full-size copy for its merge.  Nested parallel
+// partitioning fits the existing OpenMP task scheme; until then the
+// msorts are the parallel path and the qsorts the in-place path.
+
 #ifndef GB_SORT_H
 #define GB_SORT_H
 #include "GB.h"
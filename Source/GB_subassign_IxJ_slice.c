@@ -43,6 +43,12 @@
 // Instead, Methods 05 and 07 slice the matrix M, and Methods 09 and 11 slice
 // the matrix addition M+S.
 
+// FUTURE::: a reusable GxB_IndexSet object could capture the sorted,
+// deduplicated index lists and this task decomposition once, for pipelines
+// that assign into the same (I,J) selection every tick.  The object is
+// straightforward; the API change is not, since every assign/subassign
+// variant would need an overload accepting it in place of raw index lists.
+
 #include "GB_subassign_methods.h"
 
 #undef  GB_FREE_ALL
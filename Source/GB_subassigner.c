@@ -60,6 +60,27 @@
     GB_FREE_MEMORY (J2k, nj, sizeof (GrB_Index)) ;      \
 }
 
+// FUTURE::: one-shot tiled concat (GxB_Matrix_concat/split): assembling a
+// grid of tiles by repeated assign re-merges the growing result each call
+// (quadratic).  Concat needs one sizing pass over the tile Ap arrays and a
+// parallel per-tile copy into the final matrix; split is the inverse via
+// one subref per tile.  Both are standalone constructors, not assign
+// variants, since the destination pattern is known up front.
+
+// FUTURE::: full-format destination: with a pattern-free dense C every
+// assign flavor becomes an indexed scatter into C->x with no zombies or
+// pending tuples.  Methods 05d, 06d, and 21-25 already special-case a
+// dense C for the common flavors; covering all 26 needs the full storage
+// class, since the remaining methods manipulate the pattern directly.
+
+// FUTURE::: method override and instrumentation: a descriptor field could
+// pin one of the subassign methods below when the automatic choice
+// degrades, and a GxB query could report which method ran.  The selection
+// is already observable today through GxB_BURBLE, which prints the method
+// number and shape ("Method 05: C(I,J)<M> = scalar", etc.) for every call;
+// a programmatic counter array like GxB_AXB_METHOD_COUNTS would be the
+// next step, and is cheap to add if the burble proves insufficient.
+
 #include "GB_subassign.h"
 #include "GB_subassign_methods.h"
 #include "GB_subref.h"
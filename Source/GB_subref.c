@@ -78,6 +78,20 @@
     GB_FREE_MEMORY (Inext,    nI, sizeof (int64_t)) ;                       \
 }
 
+// FUTURE::: GxB gather of many rows into a caller-provided dense block
+// (GNN minibatch sampling): one subref with an unsorted row list already
+// extracts the submatrix in one pass, so the missing piece is writing
+// into caller memory with a fixed leading dimension instead of building
+// a GrB_Matrix -- an export-layout variant of subref phase2, not a new
+// traversal.
+
+// FUTURE::: O(1) views for contiguous vector ranges: C=A(:,j1:j2) of a
+// CSC matrix is the slice Ap[j1..j2+1] with shared Ai/Ax; the internal
+// is_slice machinery already represents exactly this for the dot2 workers.
+// Exposing it to users requires reference counting the parent (the view
+// must pin Ai/Ax), a read-only state for both, and kernels that accept a
+// nonzero Ap offset; until then this copying subref is the safe path.
+
 #include "GB_subref.h"
 
 GB_PUBLIC   // accessed by the MATLAB tests in GraphBLAS/Test only
@@ -14,6 +14,21 @@
 // are OK, but A never has pending tuples.  However, this function is agnostic
 // about pending tuples so they could be OK.
 
+// FUTURE::: beyond the static pin, the hyper decision could adapt per
+// matrix: track the recent conversion history here and widen the
+// effective threshold band after each flip (hysteresis), so frontiers
+// that densify then sparsify settle instead of oscillating.  The state
+// is two small fields on the matrix; the policy change is local to this
+// function and GB_to_hyper_test.
+
+// Note on format oscillation: a matrix whose nvec_nonempty hovers around
+// the hyper_ratio threshold can convert back and forth here after every
+// operation.  The per-matrix pin already exists and is the intended fix:
+// GxB_set (A, GxB_HYPER, GxB_ALWAYS_HYPER) or GxB_NEVER_HYPER fixes the
+// format of one matrix regardless of the global ratio, with zero
+// conversions thereafter.  Oscillating workloads should pin rather than
+// tune the ratio.
+
 #include "GB.h"
 
 GrB_Info GB_to_hyper_conform    // conform a matrix to its desired format
@@ -33,6 +33,23 @@
 // although the constant can be high.  The qsort method is more scalable, but
 // not as fast with a modest number of threads.
 
+// FUTURE::: lazy transpose views: most descriptor-requested transposes are
+// already avoided without materializing -- the dot methods consume A'
+// natively, GB_AxB_meta's swap rule and GB_ewise's A'+B' rewrite flip
+// orientation bits instead of moving data -- so the remaining materialized
+// transposes are those feeding saxpy3 and subassign.  A systematic view
+// flag on the operand would need every kernel family to either consume it
+// or trigger materialization at a single choke point; this function is
+// that choke point today.
+
+// FUTURE::: an auto-maintained transposed mirror: a per-matrix option
+// could keep A' cached here after the first materialization, invalidated
+// on any pattern or value change (again the pattern-version counter),
+// giving direction-optimized traversal and A'*A patterns both
+// orientations without user-side double bookkeeping.  The storage cost
+// is explicit and opt-in; the correctness cost is the invalidation
+// discipline, which is why the version counter has to come first.
+
 #include "GB_transpose.h"
 #include "GB_build.h"
 #include "GB_apply.h"
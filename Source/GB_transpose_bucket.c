@@ -36,6 +36,21 @@
 // This method is parallel, but not highly scalable.  At most O(e/m) threads
 // are used.
 
+// FUTURE::: fused transpose-accumulate, C += A': the bucket scatter
+// below already places each entry of A' exactly once, so accumulating
+// into a dense C during the scatter (instead of materializing A' and
+// adding) would cut the peak memory of symmetrization from 3x to 1x.
+// For sparse C the scatter would have to merge, which is GB_add again;
+// the dense-C case is the one worth fusing and matches subassign
+// Method 23 semantics.
+
+// FUTURE::: batch transpose: ~2000 small shard transposes each open a
+// parallel region sized for one matrix.  A GxB batch entry taking an
+// array of handles could run whole transposes as tasks in one region
+// (small shards one task each, large ones parallel as today); it is the
+// transpose instance of the batched-operation design noted in
+// GrB_mxm.c.
+
 #include "GB_transpose.h"
 
 #define GB_FREE_WORK                                                        \
@@ -35,6 +35,27 @@
 // If A is non-hypersparse, then O(n) is added in the worst case, to prune
 // zombies and to update the vector pointers for A.
 
+// FUTURE::: fine-grained wait: assembling only the vectors an operation
+// touches requires the per-vector pending lists noted in GB_Pending.h;
+// with those, this function gains a vector-range form and the GB_WAIT
+// macros pass the range the caller is about to read.
+
+// FUTURE::: asynchronous assembly: the merge below could run in a helper
+// thread against a shadow copy, atomically swapped in when complete, so
+// readers keep using the old state during a large finalize.  The swap is
+// only safe once the read path stops touching the global queue and the
+// pending list -- the lock-free finished-matrix read design -- and the
+// library would need to own a thread, which GrB_init does not currently
+// sanction.  An explicit GxB handle (start/test/finish) avoids the thread
+// ownership question by borrowing a caller thread instead.
+
+// FUTURE::: hash-compaction of pending tuples before assembly: feeds that
+// overwrite the same hot entries thousands of times between waits pay
+// O(updates log updates) in the builder sort for O(distinct) information.
+// A hash pass keyed on (i,j) with last-wins/dup semantics before GB_builder
+// would shrink the sort; it must preserve the arrival order that the stable
+// sort relies on for last-wins among duplicates.
+
 #include "GB_select.h"
 #include "GB_add.h"
 #include "GB_Pending.h"
@@ -338,7 +359,7 @@ GrB_Info GB_wait                // finish all pending computations
 
             // S = A1 + T, but with no operator
             GB_OK (GB_add (&S, A->type, A->is_csc, NULL, 0, Aslice [1], T,
-                NULL, Context)) ;
+                NULL, NULL, NULL, Context)) ;
 
             ASSERT_MATRIX_OK (S, "S = A1+T", GB0) ;
 
@@ -419,7 +440,8 @@ GrB_Info GB_wait                // finish all pending computations
         // FUTURE:: if GB_add could tolerate zombies in A, then the initial
         // prune of zombies can be skipped.
 
-        GB_OK (GB_add (&S, A->type, A->is_csc, NULL, 0, A, T, NULL, Context)) ;
+        GB_OK (GB_add (&S, A->type, A->is_csc, NULL, 0, A, T, NULL,
+            NULL, NULL, Context)) ;
         GB_MATRIX_FREE (&T) ;
         ASSERT_MATRIX_OK (S, "S after GB_wait:add", GB0) ;
         return (GB_transplant_conform (A, A->type, &S, Context)) ;
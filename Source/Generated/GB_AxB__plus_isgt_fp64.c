@@ -77,7 +77,7 @@
 
 // simd pragma for dot-product loop vectorization
 #define GB_PRAGMA_VECTORIZE_DOT \
-    GB_PRAGMA_SIMD
+    GB_PRAGMA_SIMD_REDUCTION (+,cij)
 
 // simd pragma for other loop vectorization
 #define GB_PRAGMA_VECTORIZE GB_PRAGMA_SIMD
@@ -2,6 +2,13 @@
 // GB_AxB:  hard-coded functions for semiring: C<M>=A*B or A'*B
 //------------------------------------------------------------------------------
 
+// FUTURE::: per-kernel coverage and timing: a counter per generated
+// GB_AxB_* method (incremented at worker entry under a tracing build,
+// reported via GxB) would show which of the generated kernels a
+// deployment exercises, feeding GBCOMPACT and selective-compilation
+// decisions; the generator here is where the counter hook would be
+// emitted into every method.
+
 // SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
 // http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
 
@@ -0,0 +1,115 @@
+//------------------------------------------------------------------------------
+// GrB_Matrix_removeElement: remove a single entry from a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// Removes the entry C(row,col), if it is present.  It is not an error if the
+// entry is not present; C is unchanged in that case.  The entry is marked as
+// a zombie, and the actual deletion is deferred until GB_wait assembles the
+// matrix, so a burst of removals costs one compaction, not one per call.
+// Compare with GB_setElement, which this mirrors.
+
+#include "GB.h"
+
+GrB_Info GrB_Matrix_removeElement   // remove C(row,col), if it is present
+(
+    GrB_Matrix C,                   // matrix to remove an entry from
+    GrB_Index row,                  // row index
+    GrB_Index col                   // column index
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE ("GrB_Matrix_removeElement (C, row, col)") ;
+    GB_BURBLE_START ("GrB_Matrix_removeElement") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (C) ;
+
+    if (row >= GB_NROWS (C))
+    {
+        return (GB_ERROR (GrB_INVALID_INDEX, (GB_LOG,
+            "Row index "GBu" out of range; must be < "GBd,
+            row, GB_NROWS (C)))) ;
+    }
+    if (col >= GB_NCOLS (C))
+    {
+        return (GB_ERROR (GrB_INVALID_INDEX, (GB_LOG,
+            "Column index "GBu" out of range; must be < "GBd,
+            col, GB_NCOLS (C)))) ;
+    }
+
+    // a pending tuple for C(row,col) may exist; assemble the pending tuples
+    // first so the search below sees all live entries.  Zombies are fine.
+    GB_WAIT_PENDING (C) ;
+
+    //--------------------------------------------------------------------------
+    // handle the CSR/CSC format
+    //--------------------------------------------------------------------------
+
+    int64_t i, j ;
+    if (C->is_csc)
+    {
+        // remove entry with index i in vector j
+        i = (int64_t) row ;
+        j = (int64_t) col ;
+    }
+    else
+    {
+        // remove entry with index j in vector i
+        i = (int64_t) col ;
+        j = (int64_t) row ;
+    }
+
+    //--------------------------------------------------------------------------
+    // binary search in C->h for vector j, or constant time lookup if not hyper
+    //--------------------------------------------------------------------------
+
+    int64_t pC_start, pC_end, pleft = 0, pright = C->nvec - 1 ;
+    bool found = GB_lookup (C->is_hyper, C->h, C->p, &pleft, pright, j,
+        &pC_start, &pC_end) ;
+
+    //--------------------------------------------------------------------------
+    // binary search in kth vector for index i
+    //--------------------------------------------------------------------------
+
+    bool is_zombie = false ;
+    if (found)
+    {
+        // vector j has been found; now look for index i
+        pleft = pC_start ;
+        pright = pC_end - 1 ;
+        const int64_t *Ci = C->i ;
+        GB_BINARY_SEARCH_ZOMBIE (i, Ci, pleft, pright, found, C->nzombies,
+            is_zombie) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // remove the entry, if present and not already removed
+    //--------------------------------------------------------------------------
+
+    if (found && !is_zombie)
+    {
+        // mark C(i,j) as a zombie; deletion is deferred to GB_wait
+        C->i [pleft] = GB_FLIP (i) ;
+        C->nzombies++ ;
+        if (!C->enqueued)
+        {
+            // the matrix now has deferred work; put it in the queue
+            GB_CRITICAL (GB_queue_insert (C)) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // finish the work if in blocking mode
+    //--------------------------------------------------------------------------
+
+    GrB_Info info = GB_block (C, Context) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
@@ -11,6 +11,13 @@
 // y, and z must all be the same, and the identity value must also have the
 // same type.  No typecasting is done for the identity value.
 
+// A monoid created here has no terminal (early-exit) value unless its
+// operator is one of the built-ins with a known terminal (OR, AND, MIN,
+// MAX, ...).  For a user-defined operator with a terminal value, use
+// GxB_Monoid_terminal_new instead: the terminal is honored by the generic
+// reduction and dot-product workers (via memcmp against the accumulator),
+// not only by the built-in kernels, so user monoids short-circuit too.
+
 #include "GB.h"
 
 #define GB_MONOID_NEW(type,T)                                               \
@@ -0,0 +1,79 @@
+//------------------------------------------------------------------------------
+// GrB_Vector_removeElement: remove a single entry from a vector
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// Removes the entry v(i), if it is present.  It is not an error if the entry
+// is not present; v is unchanged in that case.  See
+// GrB_Matrix_removeElement for details; a GrB_Vector is a vlen-by-1
+// non-hypersparse CSC matrix, so the vector lookup is trivial here.
+
+#include "GB.h"
+
+GrB_Info GrB_Vector_removeElement   // remove v(i), if it is present
+(
+    GrB_Vector v,                   // vector to remove an entry from
+    GrB_Index i                     // index
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE ("GrB_Vector_removeElement (v, i)") ;
+    GB_BURBLE_START ("GrB_Vector_removeElement") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (v) ;
+    ASSERT (GB_VECTOR_OK (v)) ;
+
+    if (i >= (GrB_Index) v->vlen)
+    {
+        return (GB_ERROR (GrB_INVALID_INDEX, (GB_LOG,
+            "Index "GBu" out of range; must be < "GBd,
+            i, v->vlen))) ;
+    }
+
+    // a pending tuple for v(i) may exist; assemble the pending tuples first
+    // so the search below sees all live entries.  Zombies are fine.
+    GB_WAIT_PENDING (v) ;
+
+    //--------------------------------------------------------------------------
+    // binary search for index i in the single vector of v
+    //--------------------------------------------------------------------------
+
+    int64_t index = (int64_t) i ;
+    int64_t pleft = 0 ;
+    int64_t pright = v->p [1] - 1 ;
+    bool found, is_zombie = false ;
+    const int64_t *Vi = v->i ;
+    GB_BINARY_SEARCH_ZOMBIE (index, Vi, pleft, pright, found, v->nzombies,
+        is_zombie) ;
+
+    //--------------------------------------------------------------------------
+    // remove the entry, if present and not already removed
+    //--------------------------------------------------------------------------
+
+    if (found && !is_zombie)
+    {
+        // mark v(i) as a zombie; deletion is deferred to GB_wait
+        v->i [pleft] = GB_FLIP (index) ;
+        v->nzombies++ ;
+        if (!v->enqueued)
+        {
+            // the vector now has deferred work; put it in the queue
+            GB_CRITICAL (GB_queue_insert ((GrB_Matrix) v)) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // finish the work if in blocking mode
+    //--------------------------------------------------------------------------
+
+    GrB_Info info = GB_block ((GrB_Matrix) v, Context) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
@@ -29,6 +29,7 @@
         A,              A_tran,     /* A matrix and its descriptor */       \
         B,              B_tran,     /* B matrix and its descriptor */       \
         true,                       /* eWiseAdd                    */       \
+        NULL, NULL,                 /* no eWiseUnion fill values   */       \
         Context) ;
 
 //------------------------------------------------------------------------------
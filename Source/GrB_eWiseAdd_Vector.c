@@ -33,6 +33,7 @@
         (GrB_Matrix) u, false,      /* u, never transposed         */       \
         (GrB_Matrix) v, false,      /* v, never transposed         */       \
         true,                       /* eWiseAdd                    */       \
+        NULL, NULL,                 /* no eWiseUnion fill values   */       \
         Context)
 
 //------------------------------------------------------------------------------
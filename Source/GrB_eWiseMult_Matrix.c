@@ -29,6 +29,7 @@
         A,              A_tran,     /* A matrix and its descriptor */       \
         B,              B_tran,     /* B matrix and its descriptor */       \
         false,                      /* eWiseMult                   */       \
+        NULL, NULL,                 /* no eWiseUnion fill values   */       \
         Context) ;
 
 //------------------------------------------------------------------------------
@@ -12,6 +12,15 @@
 // The input matrices A and B are optionally transposed, as determined by the
 // Descriptor desc.
 
+// FUTURE::: GxB_mxm_batch, taking arrays of C/M/A/B handles and executing
+// the whole batch inside one parallel region with one scheduler, for
+// workloads that issue tens of thousands of tiny multiplies.  The per-call
+// setup (GB_new, task construction, flop analysis, OpenMP region entry)
+// cannot be amortized from inside a single GrB_mxm call.  The small-problem
+// paths keep their setup allocation-free (stack task lists, coalesced slice
+// workspace), which is as far as per-call overhead can be cut without the
+// batch entry point.
+
 #include "GB_mxm.h"
 
 GrB_Info GrB_mxm                    // C<M> = accum (C, A*B)
@@ -2,6 +2,26 @@
 // GrB_wait: finish all pending computations
 //------------------------------------------------------------------------------
 
+// FUTURE::: true asynchronous execution: non-blocking mode today defers
+// only pending updates to a matrix; each GrB call still executes its
+// operation eagerly.  A future-returning engine (calls enqueue, a worker
+// pool runs operations whose inputs are ready, waits synchronize) needs
+// the library to own threads, dependency tracking between operations,
+// and an error model where failures surface at the wait -- all of which
+// belong to one deferred-execution design together with the DAG fusion
+// below.
+
+// FUTURE::: DAG recording and wait-time fusion: with deferred execution
+// in place, the planner can fuse adjacent operations using kernels that
+// already exist (the accum/mask pipeline, the masked multiplies) and
+// schedule independent branches concurrently.  The per-operation fusion
+// notes (reduce(A*B), C=f(A)*B, eWiseMult+reduce, sandwich scaling)
+// enumerate the rewrites such a planner would apply.  Recording can piggyback
+// on the existing queue: a deferred operation is a node holding its
+// inputs, its output handle, and the GB_* call to replay, and GrB_wait
+// on a matrix walks its reachable subgraph -- coarse whole-object
+// dependencies first, refined later.
+
 // SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
 // http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
 
@@ -311,6 +311,61 @@ GrB_Info GxB_Global_Option_get      // gets the current global option
             }
             break ;
 
+        //----------------------------------------------------------------------
+        // AxB method selection statistics
+        //----------------------------------------------------------------------
+
+        case GxB_AXB_METHOD_COUNTS : 
+
+            {
+                va_start (ap, field) ;
+                int64_t *axb_counts = va_arg (ap, int64_t *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (axb_counts) ;
+                for (int k = 0 ; k < GB_AXB_NMETHODS ; k++)
+                {
+                    axb_counts [k] = GB_Global_axb_stats_get (k) ;
+                }
+            }
+            break ;
+
+        //----------------------------------------------------------------------
+        // memory accounting
+        //----------------------------------------------------------------------
+
+        case GxB_MALLOC_TRACKING : 
+
+            {
+                va_start (ap, field) ;
+                bool *tracking = va_arg (ap, bool *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (tracking) ;
+                (*tracking) = GB_Global_malloc_tracking_get ( ) ;
+            }
+            break ;
+
+        case GxB_MEMORY_INUSE : 
+
+            {
+                va_start (ap, field) ;
+                int64_t *inuse = va_arg (ap, int64_t *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (inuse) ;
+                (*inuse) = GB_Global_inuse_get ( ) ;
+            }
+            break ;
+
+        case GxB_MEMORY_PEAK : 
+
+            {
+                va_start (ap, field) ;
+                int64_t *maxused = va_arg (ap, int64_t *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (maxused) ;
+                (*maxused) = GB_Global_maxused_get ( ) ;
+            }
+            break ;
+
         //----------------------------------------------------------------------
         // invalid option
         //----------------------------------------------------------------------
@@ -7,6 +7,13 @@
 
 //------------------------------------------------------------------------------
 
+// FUTURE::: per-context configuration: these settings are process-wide,
+// so latency-sensitive threads and bulk loaders fight over nthreads and
+// chunk.  A GxB_Context object bound per user thread (carrying nthreads,
+// chunk, and a memory budget) would be consulted by GB_GET_NTHREADS_MAX
+// before the globals; the binding needs the same thread-local machinery
+// as the error report in GB_thread_local.c.
+
 #include "GB.h"
 
 GrB_Info GxB_Global_Option_set      // set a global default option
@@ -90,6 +97,16 @@ GrB_Info GxB_Global_Option_set      // set a global default option
             }
             break ;
 
+        case GxB_MALLOC_TRACKING : 
+
+            {
+                va_start (ap, field) ;
+                bool tracking = (bool) va_arg (ap, int) ;
+                va_end (ap) ;
+                GB_Global_malloc_tracking_set (tracking) ;
+            }
+            break ;
+
         default : 
 
             return (GB_ERROR (GrB_INVALID_VALUE, (GB_LOG,
@@ -0,0 +1,86 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_apply_BinaryOp1st: apply a binary operator with a bound scalar first operand
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// C<M> = accum (C, op(x,A)) or op(x,A')
+
+#include "GB_apply.h"
+
+GrB_Info GxB_Matrix_apply_BinaryOp1st        // C<M> = accum (C, op(x,A)) or op(x,A')
+(
+    GrB_Matrix C,                   // input/output matrix for results
+    const GrB_Matrix M,             // optional mask for C, unused if NULL
+    const GrB_BinaryOp accum,       // optional accum for Z=accum(C,T)
+    const GrB_BinaryOp op,          // operator to apply to the entries
+    const GxB_Scalar x,             // scalar bound to the first operand
+    const GrB_Matrix A,             // second input:  matrix A
+    const GrB_Descriptor desc       // descriptor for C, M, and A
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE ("GxB_Matrix_apply_BinaryOp1st (C, M, accum, op, x, A, desc)") ;
+    GB_BURBLE_START ("GxB_apply") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (C) ;
+    GB_RETURN_IF_FAULTY (M) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (op) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (x) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+
+    // the scalar must be typecast to the x operand of the operator
+    if (!GB_Type_compatible (x->type, op->xtype))
+    {
+        return (GB_ERROR (GrB_DOMAIN_MISMATCH, (GB_LOG,
+            "incompatible type for z=%s(x,y):\n"
+            "input scalar type [%s]\n"
+            "cannot be typecast to operator input of type [%s]",
+            op->name, x->type->name, op->xtype->name))) ;
+    }
+
+    // finish any pending work on the scalar, which must contain an entry
+    GB_WAIT (x) ;
+    if (GB_NNZ (x) == 0)
+    {
+        return (GB_ERROR (GrB_INVALID_VALUE, (GB_LOG,
+            "scalar x must contain an entry for z=%s(x,y)", op->name))) ;
+    }
+
+    // get the descriptor
+    GB_GET_DESCRIPTOR (info, desc, C_replace, Mask_comp, Mask_struct,
+        A_transpose, xx2, xx3) ;
+
+    //--------------------------------------------------------------------------
+    // typecast the scalar to the x operand type
+    //--------------------------------------------------------------------------
+
+    size_t ssize = op->xtype->size ;
+    GB_void swork [GB_VLA(ssize)] ;
+    GB_cast_function cast_s =
+        GB_cast_factory (op->xtype->code, x->type->code) ;
+    cast_s (swork, x->x, x->type->size) ;
+
+    //--------------------------------------------------------------------------
+    // apply the operator with the bound scalar; optionally transpose A
+    //--------------------------------------------------------------------------
+
+    info = GB_apply_bind (
+        (GrB_Matrix) C,    C_replace,  // C and its descriptor
+        (GrB_Matrix) M, Mask_comp, Mask_struct, // mask and its descriptor
+        accum,                              // optional accum for Z=accum(C,T)
+        op,                                 // operator to apply to the entries
+        swork,                              // the typecast scalar
+        true,                        // scalar is bound to x
+        (GrB_Matrix) A,     A_transpose,   // A, optionally transposed
+        Context) ;
+
+    GB_BURBLE_END ;
+    return (info) ;
+}
@@ -0,0 +1,46 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_colDegree: degree of each column of a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// degree(k) = # of entries in the kth column of A, as an INT64 GrB_Vector
+// with one entry for each non-empty column.  When A is held by column, the
+// result is read straight from A->p in O(# of vectors) time, with no pass
+// over the entries; in the opposite orientation one pass over the pattern
+// is made.
+
+#include "GB.h"
+
+GrB_Info GxB_Matrix_colDegree       // degree(k) = # of entries in the kth column of A
+(
+    GrB_Vector *degree,         // output: INT64 vector
+    const GrB_Matrix A          // input matrix
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE ("GxB_Matrix_colDegree (&degree, A)") ;
+    GB_BURBLE_START ("GxB_Matrix_colDegree") ;
+    GB_RETURN_IF_NULL (degree) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+
+    // delete any lingering zombies and assemble any pending tuples
+    GrB_Info info ;
+    GB_WAIT (A) ;
+
+    //--------------------------------------------------------------------------
+    // compute the degrees
+    //--------------------------------------------------------------------------
+
+    // the columns of A are its vectors if A is held by column
+    info = GB_degree (degree, A, A->is_csc, Context) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
@@ -0,0 +1,121 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_diag: construct a diagonal matrix from a vector
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// C = diag (v,j): C is a square matrix of dimension n+abs(j) where n is the
+// length of v, with C(i,i+j) = v(i) for j >= 0, or C(i-j,i) = v(i) for
+// j < 0, and no other entries.  C has the same type as v, and is
+// constructed directly in O(n) time and O(nnz(v)) space, with no tuple
+// build and no eWise identity tricks.
+
+#include "GB.h"
+
+GrB_Info GxB_Matrix_diag        // C = diag (v,j)
+(
+    GrB_Matrix *Chandle,        // output matrix
+    const GrB_Vector v,         // input vector
+    int64_t j                   // which diagonal to construct
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE ("GxB_Matrix_diag (&C, v, j)") ;
+    GB_BURBLE_START ("GxB_Matrix_diag") ;
+    GB_RETURN_IF_NULL (Chandle) ;
+    (*Chandle) = NULL ;
+    GB_RETURN_IF_NULL_OR_FAULTY (v) ;
+    ASSERT (GB_VECTOR_OK (v)) ;
+
+    // delete any lingering zombies and assemble any pending tuples
+    GrB_Info info ;
+    GB_WAIT (v) ;
+
+    //--------------------------------------------------------------------------
+    // allocate C as a square non-hypersparse CSC matrix
+    //--------------------------------------------------------------------------
+
+    if (j <= -((int64_t) GB_INDEX_MAX) || j >= ((int64_t) GB_INDEX_MAX))
+    {
+        return (GB_ERROR (GrB_INVALID_VALUE, (GB_LOG,
+            "diagonal index "GBd" out of range", j))) ;
+    }
+
+    int64_t n = v->vlen + ((j >= 0) ? j : (-j)) ;
+    if (n > (int64_t) GB_INDEX_MAX)
+    {
+        return (GB_ERROR (GrB_INVALID_VALUE, (GB_LOG,
+            "problem too large: dimension "GBd" exceeds "GBu,
+            n, GB_INDEX_MAX))) ;
+    }
+    int64_t vnz = GB_NNZ (v) ;
+    int64_t ioffset = (j < 0) ? (-j) : 0 ;
+    int64_t joffset = (j > 0) ? j : 0 ;
+
+    GrB_Matrix C = NULL ;
+    GB_CREATE (&C, v->type, n, n, GB_Ap_calloc, true,
+        GB_FORCE_NONHYPER, GB_HYPER_DEFAULT, n, GB_IMAX (vnz, 1), true,
+        Context) ;
+    if (info != GrB_SUCCESS)
+    {
+        // out of memory
+        return (info) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // count the entries in each column of C
+    //--------------------------------------------------------------------------
+
+    int64_t *GB_RESTRICT Cp = C->p ;
+    const int64_t *GB_RESTRICT Vi = v->i ;
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int nthreads = GB_nthreads (vnz, chunk, nthreads_max) ;
+
+    int64_t p ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (p = 0 ; p < vnz ; p++)
+    {
+        // v(t) becomes the entry C(t+ioffset, t+joffset)
+        Cp [Vi [p] + joffset + 1] = 1 ;
+    }
+
+    // replace Cp with its cumulative sum
+    GB_cumsum (Cp, n, &(C->nvec_nonempty), nthreads) ;
+    C->magic = GB_MAGIC ;
+
+    //--------------------------------------------------------------------------
+    // fill the pattern and values of C
+    //--------------------------------------------------------------------------
+
+    // the entries of v are sorted by index, and each lands in its own
+    // column of C in the same order, so the scatter is monotone
+
+    int64_t *GB_RESTRICT Ci = C->i ;
+    GB_void *GB_RESTRICT Cx = C->x ;
+    const GB_void *GB_RESTRICT Vx = v->x ;
+    size_t vsize = v->type->size ;
+
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (p = 0 ; p < vnz ; p++)
+    {
+        Ci [p] = Vi [p] + ioffset ;
+        memcpy (Cx + p*vsize, Vx + p*vsize, vsize) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    ASSERT_MATRIX_OK (C, "C = diag (v,j)", GB0) ;
+    (*Chandle) = C ;
+    GB_BURBLE_END ;
+    return (GrB_SUCCESS) ;
+}
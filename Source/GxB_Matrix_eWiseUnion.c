@@ -0,0 +1,115 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_eWiseUnion: matrix element-wise union with fill values
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// C<M> = accum (C, A+B) where "+" is the given binary operator, and where
+// unmatched entries are not copied through as in GrB_eWiseAdd, but combined
+// with a fill value from the other operand:
+
+//      if A(i,j) and B(i,j) are present:  C(i,j) = op (A(i,j), B(i,j))
+//      if only A(i,j) is present:         C(i,j) = op (A(i,j), beta)
+//      if only B(i,j) is present:         C(i,j) = op (alpha, B(i,j))
+
+// alpha and beta are GxB_Scalars, which must each contain an entry.  This
+// makes subtraction-like unions a single pass: C = A-B is eWiseUnion with
+// MINUS and alpha = beta = 0, with no pre-applied negation of B.
+
+#include "GB_ewise.h"
+
+GrB_Info GxB_Matrix_eWiseUnion      // C<M> = accum (C, A+B) with fill
+(
+    GrB_Matrix C,                   // input/output matrix for results
+    const GrB_Matrix M,             // optional mask for C, unused if NULL
+    const GrB_BinaryOp accum,       // optional accum for Z=accum(C,T)
+    const GrB_BinaryOp add,         // defines '+' for T=A+B
+    const GrB_Matrix A,             // first input:  matrix A
+    const GxB_Scalar alpha,         // fill value when A(i,j) is not present
+    const GrB_Matrix B,             // second input: matrix B
+    const GxB_Scalar beta,          // fill value when B(i,j) is not present
+    const GrB_Descriptor desc       // descriptor for C, M, A, and B
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE ("GxB_Matrix_eWiseUnion (C, M, accum, add, A, alpha, B, beta,"
+        " desc)") ;
+    GB_BURBLE_START ("GxB_eWiseUnion") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (C) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (B) ;
+    GB_RETURN_IF_FAULTY (M) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (add) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (alpha) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (beta) ;
+
+    // alpha must be typecast to the x operand, and beta to the y operand
+    if (!GB_Type_compatible (alpha->type, add->xtype))
+    {
+        return (GB_ERROR (GrB_DOMAIN_MISMATCH, (GB_LOG,
+            "incompatible fill value for z=%s(x,y):\n"
+            "input scalar alpha of type [%s]\n"
+            "cannot be typecast to operator input of type [%s]",
+            add->name, alpha->type->name, add->xtype->name))) ;
+    }
+    if (!GB_Type_compatible (beta->type, add->ytype))
+    {
+        return (GB_ERROR (GrB_DOMAIN_MISMATCH, (GB_LOG,
+            "incompatible fill value for z=%s(x,y):\n"
+            "input scalar beta of type [%s]\n"
+            "cannot be typecast to operator input of type [%s]",
+            add->name, beta->type->name, add->ytype->name))) ;
+    }
+
+    // finish any pending work on the scalars; each must contain an entry
+    GB_WAIT (alpha) ;
+    GB_WAIT (beta) ;
+    if (GB_NNZ (alpha) == 0 || GB_NNZ (beta) == 0)
+    {
+        return (GB_ERROR (GrB_INVALID_VALUE, (GB_LOG,
+            "fill value scalars for z=%s(x,y) must contain entries",
+            add->name))) ;
+    }
+
+    // get the descriptor
+    GB_GET_DESCRIPTOR (info, desc, C_replace, Mask_comp, Mask_struct,
+        A_tran, B_tran, xx) ;
+
+    //--------------------------------------------------------------------------
+    // typecast the fill values to the operand types
+    //--------------------------------------------------------------------------
+
+    size_t xsize = add->xtype->size ;
+    size_t ysize = add->ytype->size ;
+    GB_void awork [GB_VLA(xsize)] ;
+    GB_void bwork [GB_VLA(ysize)] ;
+    GB_cast_factory (add->xtype->code, alpha->type->code)
+        (awork, alpha->x, alpha->type->size) ;
+    GB_cast_factory (add->ytype->code, beta->type->code)
+        (bwork, beta->x, beta->type->size) ;
+
+    //--------------------------------------------------------------------------
+    // C<M> = accum (C,T) where T = A+B with fill, A'+B, A+B', or A'+B'
+    //--------------------------------------------------------------------------
+
+    info = GB_ewise (
+        C,              C_replace,  // C and its descriptor
+        M, Mask_comp, Mask_struct,  // mask and its descriptor
+        accum,                      // accumulate operator
+        add,                        // operator that defines '+'
+        A,              A_tran,     // A matrix and its descriptor
+        B,              B_tran,     // B matrix and its descriptor
+        true,                       // eWiseAdd
+        awork, bwork,               // eWiseUnion fill values
+        Context) ;
+
+    GB_BURBLE_END ;
+    return (info) ;
+}
@@ -7,6 +7,19 @@
 
 //------------------------------------------------------------------------------
 
+// FUTURE::: a collection-level checkpoint (write a list of matrices,
+// including pending-tuple state, in parallel; restore likewise) is the
+// serialization below applied per matrix plus a manifest; including the
+// pending state means serializing the Pending list verbatim rather than
+// forcing assembly, so restore resumes exactly where ingest stopped.
+
+// FUTURE::: first-class serialization, GxB_Matrix_serialize/deserialize:
+// a single self-describing versioned blob (header with type, dimensions,
+// hypersparsity, and per-block compressed A->p/A->h/A->i/A->x, compressed
+// in parallel).  Export plus hand-rolled I/O has no versioning and no
+// compression; serialization also subsumes the memory-mapped read-only
+// matrix request, since a stable on-disk layout is its prerequisite.
+
 #include "GB_export.h"
 
 #define GB_FREE_ALL ;
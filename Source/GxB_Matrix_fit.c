@@ -0,0 +1,66 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_fit: trim the capacity of a matrix to its actual content
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// After heavy assign/delete cycles a matrix can hold A->nzmax well above
+// nnz(A), since GB_ix_resize grows capacity aggressively but shrinks it
+// rarely.  GxB_Matrix_fit finishes all pending work and then reallocates
+// A->i and A->x down to nnz(A), returning the slack to the allocator.  A
+// small hysteresis is applied: nothing is done when the slack is under
+// 1/8th of the capacity, so alternating fit/grow cycles do not thrash.
+
+// FUTURE::: GxB_Matrix_freeze would build on this: assemble, trim (as
+// here), optionally build the cached accelerators (hyperlist hash,
+// point-query index), and mark the matrix read-only so operation entry
+// skips the pending checks and concurrent readers need no care.  The
+// read-only state is the same one the mmap-backed matrices and the
+// public iterator need; unfreeze is trivial (clear the flag), freeze is
+// this function plus the flag.
+
+#include "GB.h"
+
+GrB_Info GxB_Matrix_fit         // trim A->nzmax to nnz(A)
+(
+    GrB_Matrix A                // matrix to trim
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE ("GxB_Matrix_fit (A)") ;
+    GB_BURBLE_START ("GxB_Matrix_fit") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+
+    //--------------------------------------------------------------------------
+    // finish all pending work, so that nnz(A) is the live entry count
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    GB_WAIT (A) ;
+
+    //--------------------------------------------------------------------------
+    // trim the capacity, with hysteresis
+    //--------------------------------------------------------------------------
+
+    int64_t anz = GB_NNZ (A) ;
+    if (A->nzmax - anz > A->nzmax / 8)
+    {
+        // reallocate A->i and A->x to hold exactly anz entries (at least
+        // one, to keep the arrays non-NULL); shrinking cannot fail
+        info = GB_ix_realloc (A, GB_IMAX (anz, 1), true, Context) ;
+        if (info != GrB_SUCCESS)
+        {
+            return (info) ;
+        }
+    }
+
+    GB_BURBLE_END ;
+    return (GrB_SUCCESS) ;
+}
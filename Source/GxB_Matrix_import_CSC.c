@@ -7,6 +7,15 @@
 
 //------------------------------------------------------------------------------
 
+// FUTURE::: multi-vector import: adopting an array of dense column
+// vectors as the columns of a matrix without copying is only possible
+// when the values are one contiguous block, since A->x is a single
+// array; per-vector mallocs cannot be adopted as one matrix.  The
+// workable contract is a strided/contiguous batch import (one value
+// block plus a column count), which this CSC import already handles
+// when the caller lays the vectors out contiguously -- so the missing
+// piece is a documented dense-batch convention, not a new mechanism.
+
 #include "GB_export.h"
 
 GrB_Info GxB_Matrix_import_CSC      // import a CSC matrix
@@ -7,6 +7,20 @@
 
 //------------------------------------------------------------------------------
 
+// FUTURE::: shared-memory publication is the multi-process form of the
+// mapped import below: serialize a finished matrix into a named shm
+// segment once, and let sibling processes import it read-only with the
+// component pointers aliasing the segment.  Same prerequisites (stable
+// layout, read-only state); the only addition is segment lifetime
+// management, which belongs to the application.
+
+// FUTURE::: a memory-mapped import mode, where A->p/A->h/A->i/A->x point
+// into a read-only mapped file.  The struct holds bare pointers, so the
+// mechanics fit; what is missing is (a) a stable on-disk layout (see the
+// serialization note in GxB_Matrix_export_CSR.c), and (b) a read-only
+// matrix state, since anything that conforms hypersparsity, zombifies, or
+// reallocates would have to copy-on-write first.
+
 #include "GB_export.h"
 
 GrB_Info GxB_Matrix_import_CSR      // import a CSR matrix
@@ -0,0 +1,170 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_isequal: short-circuiting equality test for two matrices
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// Tests whether A and B have the same type, dimensions, pattern, and
+// bitwise-identical values, short-circuiting on the first difference:
+// type/dimension/nvals mismatches return immediately, then the pattern
+// arrays and value arrays are compared chunk by chunk with early exit.
+// Cost is O(1) on a mismatch of shape or count, and one streaming pass in
+// the worst (equal) case -- never an eWiseMult temporary.
+
+// Values are compared bitwise, so this is representation equality: NaNs
+// compare equal to identical NaNs, and +0 differs from -0.  For
+// tolerance-based comparison of floating-point matrices, compose
+// eWiseMult with a comparator as in Demo/Source/isequal.c.  A and B must
+// be held in the same CSR/CSC format to be comparable entry-for-entry;
+// a mixed-format pair returns GrB_NO_VALUE.
+
+// FUTURE::: tolerance-based comparison for validation harnesses: a
+// fused |a-b| <= tol*max(|a|,|b|) test and a norm-of-difference
+// reduction would avoid extracting both sides.  Both are one eWiseMult
+// pass feeding a terminal monoid (LAND with early exit on the first
+// violation), so they follow the fused emult+reduce design noted in
+// GB_reduce_to_scalar.c; this bitwise test covers the exact-match
+// half.
+
+#include "GB.h"
+
+GrB_Info GxB_Matrix_isequal     // test whether A and B are identical
+(
+    bool *result,               // true if A and B are equal
+    const GrB_Matrix A,         // first matrix
+    const GrB_Matrix B          // second matrix
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE ("GxB_Matrix_isequal (&result, A, B)") ;
+    GB_RETURN_IF_NULL (result) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (B) ;
+
+    (*result) = false ;
+
+    if (A == B)
+    {
+        // same matrix: trivially equal
+        (*result) = true ;
+        return (GrB_SUCCESS) ;
+    }
+
+    if (A->is_csc != B->is_csc)
+    {
+        // mixed storage formats cannot be compared entry-for-entry here
+        return (GrB_NO_VALUE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // O(1) short circuits: type, dimensions, entry count
+    //--------------------------------------------------------------------------
+
+    if (A->type != B->type || A->vlen != B->vlen || A->vdim != B->vdim)
+    {
+        return (GrB_SUCCESS) ;
+    }
+
+    // assemble pending work so the counts and patterns are exact
+    GrB_Info info ;
+    GB_WAIT (A) ;
+    GB_WAIT (B) ;
+
+    int64_t anz = GB_NNZ (A) ;
+    if (anz != GB_NNZ (B))
+    {
+        // note that nvec_nonempty is not compared: it is computed lazily
+        // and may be -1 on one side of an otherwise identical pair
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // compare the patterns and values, chunked with early exit
+    //--------------------------------------------------------------------------
+
+    // compare the vector structure.  A and B may differ in hypersparsity;
+    // compare the implied (vector, count) structure instead of raw arrays
+    // when they do.
+
+    if (A->is_hyper == B->is_hyper)
+    {
+        if (A->nvec != B->nvec)
+        {
+            return (GrB_SUCCESS) ;
+        }
+        if (memcmp (A->p, B->p, (A->nvec + 1) * sizeof (int64_t)) != 0)
+        {
+            return (GrB_SUCCESS) ;
+        }
+        if (A->is_hyper &&
+            memcmp (A->h, B->h, A->nvec * sizeof (int64_t)) != 0)
+        {
+            return (GrB_SUCCESS) ;
+        }
+    }
+    else
+    {
+        // one is hypersparse and the other is not: walk the non-empty
+        // vectors of both in tandem
+        GrB_Matrix H = A->is_hyper ? A : B ;    // hypersparse one
+        GrB_Matrix S = A->is_hyper ? B : A ;    // standard one
+        int64_t kh = 0 ;
+        for (int64_t j = 0 ; j < S->vdim ; j++)
+        {
+            int64_t sjnz = S->p [j+1] - S->p [j] ;
+            int64_t hjnz = 0 ;
+            if (kh < H->nvec && H->h [kh] == j)
+            {
+                hjnz = H->p [kh+1] - H->p [kh] ;
+                if (S->p [j] != H->p [kh])
+                {
+                    return (GrB_SUCCESS) ;
+                }
+                kh++ ;
+            }
+            if (sjnz != hjnz)
+            {
+                return (GrB_SUCCESS) ;
+            }
+        }
+        if (kh != H->nvec)
+        {
+            return (GrB_SUCCESS) ;
+        }
+    }
+
+    // compare the indices and values in chunks, stopping at the first
+    // difference; the arrays are typically large, so the early exit is
+    // what makes mismatches cheap
+
+    #define GB_ISEQUAL_CHUNK (4*1024*1024)
+    size_t asize = A->type_size ;
+    const GB_void *GB_RESTRICT Ai = (const GB_void *) A->i ;
+    const GB_void *GB_RESTRICT Bi = (const GB_void *) B->i ;
+    const GB_void *GB_RESTRICT Ax = A->x ;
+    const GB_void *GB_RESTRICT Bx = B->x ;
+
+    for (int64_t p = 0 ; p < anz ; p += GB_ISEQUAL_CHUNK)
+    {
+        int64_t len = GB_IMIN (GB_ISEQUAL_CHUNK, anz - p) ;
+        if (memcmp (Ai + p * sizeof (int64_t), Bi + p * sizeof (int64_t),
+            len * sizeof (int64_t)) != 0)
+        {
+            return (GrB_SUCCESS) ;
+        }
+        if (memcmp (Ax + p * asize, Bx + p * asize, len * asize) != 0)
+        {
+            return (GrB_SUCCESS) ;
+        }
+    }
+
+    (*result) = true ;
+    return (GrB_SUCCESS) ;
+}
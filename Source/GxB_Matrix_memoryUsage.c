@@ -0,0 +1,73 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_memoryUsage: report the memory held by a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// Returns the number of bytes held by the matrix: the header, the vector
+// pointers A->p, the hyperlist A->h, the pattern A->i, the values A->x,
+// and any pending tuples.  Shallow components (internal only) are not
+// counted.  The count reflects allocated capacity (A->nzmax), not just
+// live entries, so it attributes resident memory faithfully; see
+// GxB_Matrix_fit to trim the capacity.  No pending work is finished and
+// the matrix is not modified, so this is cheap enough to poll.
+
+#include "GB.h"
+#include "GB_Pending.h"
+
+GrB_Info GxB_Matrix_memoryUsage     // # of bytes held by a matrix
+(
+    size_t *size,                   // # of bytes
+    const GrB_Matrix A              // matrix to query
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE ("GxB_Matrix_memoryUsage (&size, A)") ;
+    GB_RETURN_IF_NULL (size) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+
+    //--------------------------------------------------------------------------
+    // add up the components
+    //--------------------------------------------------------------------------
+
+    size_t s = sizeof (struct GB_Matrix_opaque) ;
+
+    if (A->p != NULL && !A->p_shallow)
+    {
+        s += (A->plen + 1) * sizeof (int64_t) ;
+    }
+    if (A->h != NULL && !A->h_shallow)
+    {
+        s += A->plen * sizeof (int64_t) ;
+    }
+    if (A->i != NULL && !A->i_shallow)
+    {
+        s += A->nzmax * sizeof (int64_t) ;
+    }
+    if (A->x != NULL && !A->x_shallow)
+    {
+        s += A->nzmax * A->type_size ;
+    }
+
+    GB_Pending Pending = A->Pending ;
+    if (Pending != NULL)
+    {
+        s += sizeof (struct GB_Pending_struct) ;
+        s += Pending->nmax * sizeof (int64_t) ;                 // Pending->i
+        if (Pending->j != NULL)
+        {
+            s += Pending->nmax * sizeof (int64_t) ;             // Pending->j
+        }
+        s += Pending->nmax * Pending->size ;                    // Pending->x
+    }
+
+    (*size) = s ;
+    return (GrB_SUCCESS) ;
+}
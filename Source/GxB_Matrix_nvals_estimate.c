@@ -0,0 +1,50 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_nvals_estimate: bounds on nvals without forcing assembly
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// GrB_Matrix_nvals must finish all pending work to report an exact count,
+// which defeats the batching benefit of non-blocking mode when the caller
+// is only a monitoring probe.  This query returns bounds in O(1) without
+// assembling anything: the lower bound is the live stored entries (stored
+// minus zombies), and the upper bound adds the pending tuples, which may
+// be duplicates or overwrites.  The bounds coincide exactly when the
+// matrix has no pending work, in which case they equal GrB_Matrix_nvals.
+
+#include "GB_Pending.h"
+
+GrB_Info GxB_Matrix_nvals_estimate  // bounds on nvals, without assembly
+(
+    GrB_Index *lower,               // lower bound on nvals(A)
+    GrB_Index *upper,               // upper bound on nvals(A)
+    const GrB_Matrix A              // matrix to query
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE ("GxB_Matrix_nvals_estimate (&lower, &upper, A)") ;
+    GB_RETURN_IF_NULL (lower) ;
+    GB_RETURN_IF_NULL (upper) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+
+    //--------------------------------------------------------------------------
+    // compute the bounds from the stored, zombie, and pending counts
+    //--------------------------------------------------------------------------
+
+    int64_t live = GB_NNZ (A) - A->nzombies ;
+    int64_t npending = GB_Pending_n (A) ;
+
+    // pending tuples can resurrect zombies, overwrite live entries, or be
+    // duplicates of each other, so they contribute anywhere from 0 to
+    // npending new entries
+    (*lower) = (GrB_Index) live ;
+    (*upper) = (GrB_Index) (live + npending) ;
+    return (GrB_SUCCESS) ;
+}
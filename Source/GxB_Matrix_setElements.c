@@ -0,0 +1,103 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_setElements: bulk update of a matrix from a list of tuples
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// C(I(k),J(k)) = X(k) for all k in 0:nvals-1, as if by nvals calls to
+// GrB_Matrix_setElement, except that duplicates within the batch are
+// combined with the dup operator (as in GrB_Matrix_build) instead of
+// last-one-wins.  Entries of C not referenced by the batch are unchanged;
+// entries referenced by the batch are overwritten.
+
+// This is the bulk-ingest form of setElement: the batch of tuples is
+// assembled with the GB_builder machinery (one sort, one merge), then
+// written into C through GB_subassigner, which scatters into C in place and
+// queues any entries new to C's pattern as pending tuples.  The values X
+// must be of type C->type; use GrB_Matrix_build to construct a new matrix
+// from typed arrays.
+
+#include "GB_build.h"
+#include "GB_subassign.h"
+
+GrB_Info GxB_Matrix_setElements     // C(I(k),J(k)) = X(k), in bulk
+(
+    GrB_Matrix C,                   // matrix to update
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const void *X,                  // array of values, of type C->type
+    GrB_Index nvals,                // number of tuples
+    const GrB_BinaryOp dup          // binary op to assemble batch duplicates
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE ("GxB_Matrix_setElements (C, I, J, X, nvals, dup)") ;
+    GB_BURBLE_START ("GxB_setElements") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (C) ;
+
+    //--------------------------------------------------------------------------
+    // quick return for an empty batch
+    //--------------------------------------------------------------------------
+
+    if (nvals == 0)
+    {
+        GB_BURBLE_END ;
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // T = sorted, deduplicated batch of tuples
+    //--------------------------------------------------------------------------
+
+    // T matches the dimensions, type, and orientation of C, so the indices
+    // need no translation and the assignment below does no typecasting.
+
+    GrB_Info info ;
+    GrB_Matrix T = NULL ;
+    GB_NEW (&T, C->type, C->vlen, C->vdim, GB_Ap_calloc, C->is_csc,
+        GB_AUTO_HYPER, GB_HYPER_DEFAULT, 1, Context) ;
+    if (info != GrB_SUCCESS)
+    {
+        // out of memory
+        return (info) ;
+    }
+
+    info = GB_matvec_build (T, I, J, X, nvals, dup, C->type->code, true,
+        Context) ;
+    if (info != GrB_SUCCESS)
+    {
+        GB_MATRIX_FREE (&T) ;
+        return (info) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // C<T,structural> = T: overwrite the batched entries, keep the rest
+    //--------------------------------------------------------------------------
+
+    info = GB_subassigner (
+        C, false,                   // C, no C_replace
+        T, false, true,             // structural mask T, not complemented
+        NULL,                       // no accum: batched entries overwrite
+        T,                          // the assembled batch of tuples
+        GrB_ALL, 0, GrB_ALL, 0,     // all of C
+        false, NULL, GB_ignore_code,    // no scalar expansion
+        Context) ;
+
+    GB_MATRIX_FREE (&T) ;
+    if (info != GrB_SUCCESS)
+    {
+        return (info) ;
+    }
+
+    // finish the work if in blocking mode
+    info = GB_block (C, Context) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
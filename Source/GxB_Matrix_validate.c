@@ -0,0 +1,135 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_validate: lightweight structural validation of a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// A production-affordable subset of GB_Matrix_check: O(nvec) monotonicity
+// and bound checks on A->p (and strict ascent of A->h when hypersparse),
+// plus sortedness and index-bound checks on the pattern of up to nsamples
+// sampled vectors.  Returns GrB_INVALID_OBJECT if corruption is detected,
+// so bad imports fail at the API boundary instead of deep inside a
+// kernel.  Unlike GxB_Matrix_fprint with GB_Matrix_check, the cost does
+// not grow with nnz(A) unless nsamples asks for it; pass nsamples equal
+// to the number of vectors for a full pattern check.  Zombies are
+// tolerated (their flipped indices are checked unflipped); pending
+// tuples are not examined.
+
+#include "GB.h"
+
+#define GB_CORRUPT(fmt,...)                                     \
+    return (GB_ERROR (GrB_INVALID_OBJECT, (GB_LOG,              \
+        "matrix invalid: " fmt, __VA_ARGS__))) ;
+
+GrB_Info GxB_Matrix_validate    // check the structure of a matrix
+(
+    const GrB_Matrix A,         // matrix to validate
+    GrB_Index nsamples          // # of vectors whose pattern is checked
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE ("GxB_Matrix_validate (A, nsamples)") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+
+    //--------------------------------------------------------------------------
+    // O(nvec) checks on the vector pointers and hyperlist
+    //--------------------------------------------------------------------------
+
+    int64_t anvec = A->nvec ;
+    int64_t avlen = A->vlen ;
+    const int64_t *GB_RESTRICT Ap = A->p ;
+    const int64_t *GB_RESTRICT Ah = A->h ;
+    const int64_t *GB_RESTRICT Ai = A->i ;
+
+    if (Ap == NULL)
+    {
+        GB_CORRUPT ("A->p is NULL (%s)", A->type->name) ;
+    }
+    if (anvec < 0 || anvec > A->plen || A->plen > A->vdim)
+    {
+        GB_CORRUPT ("nvec "GBd" out of range [0, plen "GBd", vdim "GBd"]",
+            anvec, A->plen, A->vdim) ;
+    }
+    if (Ap [0] != 0)
+    {
+        GB_CORRUPT ("Ap [0] = "GBd", must be zero", Ap [0]) ;
+    }
+
+    for (int64_t k = 0 ; k < anvec ; k++)
+    {
+        if (Ap [k+1] < Ap [k])
+        {
+            GB_CORRUPT ("Ap ["GBd"] = "GBd" decreases to "GBd,
+                k, Ap [k], Ap [k+1]) ;
+        }
+        if (A->is_hyper && k > 0 && Ah [k] <= Ah [k-1])
+        {
+            GB_CORRUPT ("Ah ["GBd"] = "GBd" does not ascend", k, Ah [k]) ;
+        }
+        if (A->is_hyper && (Ah [k] < 0 || Ah [k] >= A->vdim))
+        {
+            GB_CORRUPT ("Ah ["GBd"] = "GBd" out of range", k, Ah [k]) ;
+        }
+    }
+
+    if (Ap [anvec] > A->nzmax)
+    {
+        GB_CORRUPT ("Ap [nvec] = "GBd" exceeds nzmax "GBd,
+            Ap [anvec], A->nzmax) ;
+    }
+    if (Ap [anvec] > 0 && Ai == NULL)
+    {
+        GB_CORRUPT ("A->i is NULL with "GBd" entries", Ap [anvec]) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // sampled pattern checks: sortedness and index bounds per vector
+    //--------------------------------------------------------------------------
+
+    int64_t ns = (nsamples > (GrB_Index) anvec) ? anvec : ((int64_t) nsamples) ;
+    if (ns > 0)
+    {
+        // sample vectors at a uniform stride so repeated calls with small
+        // nsamples still cover the matrix deterministically
+        int64_t stride = GB_IMAX (anvec / ns, 1) ;
+        int64_t nzombies = 0 ;
+        for (int64_t k = 0 ; k < anvec ; k += stride)
+        {
+            int64_t ilast = -1 ;
+            for (int64_t p = Ap [k] ; p < Ap [k+1] ; p++)
+            {
+                int64_t i = Ai [p] ;
+                if (GB_IS_ZOMBIE (i))
+                {
+                    i = GB_UNFLIP (i) ;
+                    nzombies++ ;
+                }
+                if (i < 0 || i >= avlen)
+                {
+                    GB_CORRUPT ("index Ai ["GBd"] = "GBd" out of range in"
+                        " vector "GBd, p, i, k) ;
+                }
+                if (i <= ilast)
+                {
+                    GB_CORRUPT ("indices not sorted in vector "GBd
+                        " at Ai ["GBd"]", k, p) ;
+                }
+                ilast = i ;
+            }
+        }
+        if (nzombies > A->nzombies)
+        {
+            GB_CORRUPT ("more zombies found ("GBd") than recorded ("GBd")",
+                nzombies, A->nzombies) ;
+        }
+    }
+
+    return (GrB_SUCCESS) ;
+}
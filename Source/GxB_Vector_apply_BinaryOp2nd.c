@@ -0,0 +1,90 @@
+//------------------------------------------------------------------------------
+// GxB_Vector_apply_BinaryOp2nd: apply a binary operator with a bound scalar second operand
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// w<mask> = accum (w, op(u,y))
+
+#include "GB_apply.h"
+
+GrB_Info GxB_Vector_apply_BinaryOp2nd   // w<mask> = accum (w, op(u,y))
+(
+    GrB_Vector w,                   // input/output vector for results
+    const GrB_Vector mask,          // optional mask for w, unused if NULL
+    const GrB_BinaryOp accum,       // optional accum for z=accum(w,t)
+    const GrB_BinaryOp op,          // operator to apply to the entries
+    const GrB_Vector u,             // first input:  vector u
+    const GxB_Scalar y,             // scalar bound to the second operand
+    const GrB_Descriptor desc       // descriptor for w and mask
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE ("GxB_Vector_apply_BinaryOp2nd (w, mask, accum, op, u, y, desc)") ;
+    GB_BURBLE_START ("GxB_apply") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (w) ;
+    GB_RETURN_IF_FAULTY (mask) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (op) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (y) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (u) ;
+
+    ASSERT (GB_VECTOR_OK (w)) ;
+    ASSERT (mask == NULL || GB_VECTOR_OK (mask)) ;
+    ASSERT (GB_VECTOR_OK (u)) ;
+
+    // the scalar must be typecast to the y operand of the operator
+    if (!GB_Type_compatible (y->type, op->ytype))
+    {
+        return (GB_ERROR (GrB_DOMAIN_MISMATCH, (GB_LOG,
+            "incompatible type for z=%s(x,y):\n"
+            "input scalar type [%s]\n"
+            "cannot be typecast to operator input of type [%s]",
+            op->name, y->type->name, op->ytype->name))) ;
+    }
+
+    // finish any pending work on the scalar, which must contain an entry
+    GB_WAIT (y) ;
+    if (GB_NNZ (y) == 0)
+    {
+        return (GB_ERROR (GrB_INVALID_VALUE, (GB_LOG,
+            "scalar y must contain an entry for z=%s(x,y)", op->name))) ;
+    }
+
+    // get the descriptor
+    GB_GET_DESCRIPTOR (info, desc, C_replace, Mask_comp, Mask_struct,
+        xx1, xx2, xx3) ;
+
+    //--------------------------------------------------------------------------
+    // typecast the scalar to the y operand type
+    //--------------------------------------------------------------------------
+
+    size_t ssize = op->ytype->size ;
+    GB_void swork [GB_VLA(ssize)] ;
+    GB_cast_function cast_s =
+        GB_cast_factory (op->ytype->code, y->type->code) ;
+    cast_s (swork, y->x, y->type->size) ;
+
+    //--------------------------------------------------------------------------
+    // apply the operator with the bound scalar; do not transpose
+    //--------------------------------------------------------------------------
+
+    info = GB_apply_bind (
+        (GrB_Matrix) w,    C_replace,  // w and its descriptor
+        (GrB_Matrix) mask, Mask_comp, Mask_struct, // mask and its descriptor
+        accum,                              // optional accum for Z=accum(C,T)
+        op,                                 // operator to apply to the entries
+        swork,                              // the typecast scalar
+        false,                        // scalar is bound to y
+        (GrB_Matrix) u,     false,   // u, not transposed
+        Context) ;
+
+    GB_BURBLE_END ;
+    return (info) ;
+}
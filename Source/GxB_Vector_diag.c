@@ -0,0 +1,165 @@
+//------------------------------------------------------------------------------
+// GxB_Vector_diag: extract a diagonal of a matrix into a vector
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// v = diag (A,j): v(i) = A(i,i+j) if j >= 0, or v(i) = A(i-j,i) if j < 0.
+// The length of v must match the length of the jth diagonal of A.  Any prior
+// content of v is cleared.  The pattern of v consists of the diagonal
+// entries present in A; each one is found with a binary search in its
+// vector, so the work is O(d log(max row/column degree)) for a diagonal of
+// length d, not O(nnz(A)).
+
+#include "GB.h"
+
+#define GB_FREE_ALL                                 \
+{                                                   \
+    GB_FREE_MEMORY (P, dlen, sizeof (int64_t)) ;    \
+    GB_MATRIX_FREE (&T) ;                           \
+}
+
+GrB_Info GxB_Vector_diag        // v = diag (A,j)
+(
+    GrB_Vector v,               // output vector (any prior content cleared)
+    const GrB_Matrix A,         // input matrix
+    int64_t j,                  // which diagonal to extract
+    const GrB_Descriptor desc   // unused, except threading control
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE ("GxB_Vector_diag (v, A, j, desc)") ;
+    GB_BURBLE_START ("GxB_Vector_diag") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (v) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_RETURN_IF_FAULTY (desc) ;
+    ASSERT (GB_VECTOR_OK (v)) ;
+
+    if (!GB_Type_compatible (v->type, A->type))
+    {
+        return (GB_ERROR (GrB_DOMAIN_MISMATCH, (GB_LOG,
+            "entries in A of type [%s] cannot be typecast to v of type [%s]",
+            A->type->name, v->type->name))) ;
+    }
+
+    if (j <= -((int64_t) GB_INDEX_MAX) || j >= ((int64_t) GB_INDEX_MAX))
+    {
+        return (GB_ERROR (GrB_INVALID_VALUE, (GB_LOG,
+            "diagonal index "GBd" out of range", j))) ;
+    }
+
+    int64_t anrows = GB_NROWS (A) ;
+    int64_t ancols = GB_NCOLS (A) ;
+    int64_t dlen = (j >= 0) ? GB_IMIN (anrows, ancols - j)
+                            : GB_IMIN (anrows + j, ancols) ;
+    dlen = GB_IMAX (dlen, 0) ;
+
+    if (v->vlen != dlen)
+    {
+        return (GB_ERROR (GrB_DIMENSION_MISMATCH, (GB_LOG,
+            "v must have length "GBd", the length of the "GBd"th diagonal"
+            " of A", dlen, j))) ;
+    }
+
+    // delete any lingering zombies and assemble any pending tuples
+    GrB_Info info ;
+    GB_WAIT (A) ;
+
+    int64_t *GB_RESTRICT P = NULL ;
+    GrB_Matrix T = NULL ;
+
+    //--------------------------------------------------------------------------
+    // find the position of each diagonal entry
+    //--------------------------------------------------------------------------
+
+    // entry t of the diagonal is A(it,jt) with it = t + (j < 0 ? -j : 0)
+    // and jt = t + (j > 0 ? j : 0); in the CSR/CSC-agnostic view it lies in
+    // vector (A->is_csc ? jt : it) at index (A->is_csc ? it : jt)
+
+    GB_MALLOC_MEMORY (P, dlen, sizeof (int64_t)) ;
+    if (P == NULL && dlen > 0)
+    {
+        // out of memory
+        return (GB_OUT_OF_MEMORY) ;
+    }
+
+    int64_t ioffset = (j < 0) ? (-j) : 0 ;
+    int64_t joffset = (j > 0) ? j : 0 ;
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int nthreads = GB_nthreads (dlen, chunk, nthreads_max) ;
+
+    int64_t t ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1024)
+    for (t = 0 ; t < dlen ; t++)
+    {
+        int64_t vec = A->is_csc ? (t + joffset) : (t + ioffset) ;
+        int64_t idx = A->is_csc ? (t + ioffset) : (t + joffset) ;
+        int64_t pA_start, pA_end, pleft = 0, pright = A->nvec - 1 ;
+        bool found = GB_lookup (A->is_hyper, A->h, A->p, &pleft, pright,
+            vec, &pA_start, &pA_end) ;
+        if (found)
+        {
+            pleft = pA_start ;
+            pright = pA_end - 1 ;
+            GB_BINARY_SEARCH (idx, A->i, pleft, pright, found) ;
+        }
+        P [t] = found ? pleft : -1 ;
+    }
+
+    //--------------------------------------------------------------------------
+    // construct T = diag entries as a dlen-by-1 vector
+    //--------------------------------------------------------------------------
+
+    int64_t vnz = 0 ;
+    for (t = 0 ; t < dlen ; t++)
+    {
+        if (P [t] >= 0) vnz++ ;
+    }
+
+    GB_CREATE (&T, A->type, dlen, 1, GB_Ap_malloc, true,
+        GB_FORCE_NONHYPER, GB_HYPER_DEFAULT, 1, GB_IMAX (vnz, 1), true,
+        Context) ;
+    if (info != GrB_SUCCESS)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (info) ;
+    }
+
+    T->p [0] = 0 ;
+    T->p [1] = vnz ;
+    T->nvec_nonempty = (vnz > 0) ? 1 : 0 ;
+    T->magic = GB_MAGIC ;
+
+    size_t asize = A->type->size ;
+    const GB_void *GB_RESTRICT Ax = A->x ;
+    GB_void *GB_RESTRICT Tx = T->x ;
+    int64_t p = 0 ;
+    for (t = 0 ; t < dlen ; t++)
+    {
+        if (P [t] >= 0)
+        {
+            T->i [p] = t ;
+            memcpy (Tx + p*asize, Ax + P [t] * asize, asize) ;
+            p++ ;
+        }
+    }
+
+    GB_FREE_MEMORY (P, dlen, sizeof (int64_t)) ;
+
+    //--------------------------------------------------------------------------
+    // v = (vtype) T, clearing any prior content of v
+    //--------------------------------------------------------------------------
+
+    info = GB_transplant_conform ((GrB_Matrix) v, v->type, &T, Context) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
@@ -0,0 +1,111 @@
+//------------------------------------------------------------------------------
+// GxB_Vector_eWiseUnion: vector element-wise union with fill values
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// w<mask> = accum (w, u+v), with fill values for unmatched entries.
+// See GxB_Matrix_eWiseUnion for a description of the fill semantics.
+
+#include "GB_ewise.h"
+
+GrB_Info GxB_Vector_eWiseUnion      // w<mask> = accum (w, u+v) with fill
+(
+    GrB_Vector w,                   // input/output vector for results
+    const GrB_Vector mask,          // optional mask for w, unused if NULL
+    const GrB_BinaryOp accum,       // optional accum for z=accum(w,t)
+    const GrB_BinaryOp add,         // defines '+' for t=u+v
+    const GrB_Vector u,             // first input:  vector u
+    const GxB_Scalar alpha,         // fill value when u(i) is not present
+    const GrB_Vector v,             // second input: vector v
+    const GxB_Scalar beta,          // fill value when v(i) is not present
+    const GrB_Descriptor desc       // descriptor for w and mask
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE ("GxB_Vector_eWiseUnion (w, mask, accum, add, u, alpha, v, beta,"
+        " desc)") ;
+    GB_BURBLE_START ("GxB_eWiseUnion") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (w) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (u) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (v) ;
+    GB_RETURN_IF_FAULTY (mask) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (add) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (alpha) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (beta) ;
+
+    ASSERT (GB_VECTOR_OK (w)) ;
+    ASSERT (GB_VECTOR_OK (u)) ;
+    ASSERT (GB_VECTOR_OK (v)) ;
+    ASSERT (mask == NULL || GB_VECTOR_OK (mask)) ;
+
+    // alpha must be typecast to the x operand, and beta to the y operand
+    if (!GB_Type_compatible (alpha->type, add->xtype))
+    {
+        return (GB_ERROR (GrB_DOMAIN_MISMATCH, (GB_LOG,
+            "incompatible fill value for z=%s(x,y):\n"
+            "input scalar alpha of type [%s]\n"
+            "cannot be typecast to operator input of type [%s]",
+            add->name, alpha->type->name, add->xtype->name))) ;
+    }
+    if (!GB_Type_compatible (beta->type, add->ytype))
+    {
+        return (GB_ERROR (GrB_DOMAIN_MISMATCH, (GB_LOG,
+            "incompatible fill value for z=%s(x,y):\n"
+            "input scalar beta of type [%s]\n"
+            "cannot be typecast to operator input of type [%s]",
+            add->name, beta->type->name, add->ytype->name))) ;
+    }
+
+    // finish any pending work on the scalars; each must contain an entry
+    GB_WAIT (alpha) ;
+    GB_WAIT (beta) ;
+    if (GB_NNZ (alpha) == 0 || GB_NNZ (beta) == 0)
+    {
+        return (GB_ERROR (GrB_INVALID_VALUE, (GB_LOG,
+            "fill value scalars for z=%s(x,y) must contain entries",
+            add->name))) ;
+    }
+
+    // get the descriptor
+    GB_GET_DESCRIPTOR (info, desc, C_replace, Mask_comp, Mask_struct,
+        xx1, xx2, xx3) ;
+
+    //--------------------------------------------------------------------------
+    // typecast the fill values to the operand types
+    //--------------------------------------------------------------------------
+
+    size_t xsize = add->xtype->size ;
+    size_t ysize = add->ytype->size ;
+    GB_void awork [GB_VLA(xsize)] ;
+    GB_void bwork [GB_VLA(ysize)] ;
+    GB_cast_factory (add->xtype->code, alpha->type->code)
+        (awork, alpha->x, alpha->type->size) ;
+    GB_cast_factory (add->ytype->code, beta->type->code)
+        (bwork, beta->x, beta->type->size) ;
+
+    //--------------------------------------------------------------------------
+    // w<mask> = accum (w,t) where t = u+v with fill
+    //--------------------------------------------------------------------------
+
+    info = GB_ewise (
+        (GrB_Matrix) w, C_replace,  // w and its descriptor
+        (GrB_Matrix) mask, Mask_comp, Mask_struct, // mask and its descriptor
+        accum,                      // accumulate operator
+        add,                        // operator that defines '+'
+        (GrB_Matrix) u, false,      // u, never transposed
+        (GrB_Matrix) v, false,      // v, never transposed
+        true,                       // eWiseAdd
+        awork, bwork,               // eWiseUnion fill values
+        Context) ;
+
+    GB_BURBLE_END ;
+    return (info) ;
+}
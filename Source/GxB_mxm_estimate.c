@@ -0,0 +1,98 @@
+//------------------------------------------------------------------------------
+// GxB_mxm_estimate: estimate the cost and output size of C<M>=A*B
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// Exposes the flop-count analysis used internally by the AxB method
+// selection (GB_AxB_flopcount), so external schedulers can route large
+// multiplies without computing them.  On return, *flops is the number of
+// multiply-add pairs that C<M>=A*B would perform, and *cnvals_bound is an
+// upper bound on nnz(C), namely min (flops, nrows*ncols).  No transposes
+// are applied: the estimate is for the matrices exactly as stored, and A
+// and B (and M, if present) must be held in the same CSR/CSC format; a
+// mixed-format pair returns GrB_NO_VALUE, since its product would be
+// computed through a transpose whose cost this estimate cannot see.
+
+#include "GB_mxm.h"
+
+GrB_Info GxB_mxm_estimate       // estimate the cost of C<M>=A*B
+(
+    double *flops,              // estimated # of multiply-add pairs
+    double *cnvals_bound,       // upper bound on nnz(C)
+    const GrB_Matrix M,         // optional mask, may be NULL
+    const GrB_Matrix A,         // first input: matrix A
+    const GrB_Matrix B          // second input: matrix B
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE ("GxB_mxm_estimate (&flops, &cnvals_bound, M, A, B)") ;
+    GB_RETURN_IF_NULL (flops) ;
+    GB_RETURN_IF_NULL (cnvals_bound) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (B) ;
+    GB_RETURN_IF_FAULTY (M) ;
+
+    if (A->is_csc != B->is_csc || (M != NULL && M->is_csc != A->is_csc))
+    {
+        // mixed storage formats: the multiply would go through a transpose
+        // whose cost this estimate cannot see
+        return (GrB_NO_VALUE) ;
+    }
+
+    if (GB_NCOLS (A) != GB_NROWS (B))
+    {
+        return (GB_ERROR (GrB_DIMENSION_MISMATCH, (GB_LOG,
+            "A is "GBd"-by-"GBd"; B is "GBd"-by-"GBd,
+            GB_NROWS (A), GB_NCOLS (A), GB_NROWS (B), GB_NCOLS (B)))) ;
+    }
+
+    // assemble any pending work so the counts reflect live entries
+    GrB_Info info ;
+    GB_WAIT (A) ;
+    GB_WAIT (B) ;
+    GB_WAIT (M) ;
+
+    //--------------------------------------------------------------------------
+    // in the CSR/CSC-agnostic view, the product is (first)*(second), where
+    // the pair is (A,B) for CSC and (B,A) for CSR
+    //--------------------------------------------------------------------------
+
+    GrB_Matrix A1 = A->is_csc ? A : B ;
+    GrB_Matrix B1 = A->is_csc ? B : A ;
+
+    int64_t bnvec = B1->nvec ;
+    int64_t *GB_RESTRICT Bflops = NULL ;
+    GB_CALLOC_MEMORY (Bflops, bnvec + 1, sizeof (int64_t)) ;
+    if (Bflops == NULL)
+    {
+        return (GB_OUT_OF_MEMORY) ;
+    }
+
+    int64_t Mwork = 0 ;
+    info = GB_AxB_flopcount (&Mwork, Bflops, M, false, A1, B1, Context) ;
+    if (info != GrB_SUCCESS)
+    {
+        GB_FREE_MEMORY (Bflops, bnvec + 1, sizeof (int64_t)) ;
+        return (info) ;
+    }
+
+    double total = (double) (Bflops [bnvec]) - (double) Mwork ;
+    GB_FREE_MEMORY (Bflops, bnvec + 1, sizeof (int64_t)) ;
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    (*flops) = total ;
+    double cmax = ((double) A1->vlen) * ((double) B1->vdim) ;
+    (*cnvals_bound) = GB_IMIN (total, cmax) ;
+    return (GrB_SUCCESS) ;
+}
@@ -25,6 +25,14 @@
 // since that is faster for the saxpy-based methods (y is the value of B(k,j),
 // which is loaded less frequently from memory than A(i,k)).
 
+// FUTURE::: positional operators (z = row or column index of the entry) as
+// built-in multiply ops with MIN/ANY monoids, for BFS-parent and
+// connected-components.  They need their own opcode range, expansions here
+// and in GB_binop_factory.c, and kernels that read Ai/Bi instead of Ax/Bx
+// -- a regeneration of Source/Generated, not a patch.  Until then the idiom
+// is to pack indices into values once with extractTuples/build and multiply
+// with FIRST/SECOND semirings.
+
 {
     //--------------------------------------------------------------------------
     // launch the switch factory
@@ -83,6 +83,21 @@
     // Coarse tasks: nothing to do in phase2.
     // Fine tasks: compute nnz (C(:,j)), and values in Hx via atomics.
 
+    // FUTURE::: cooperative cancellation: a token checked here at task
+    // boundaries (and at the per-vector loops of the add/subassign
+    // templates) would let a runaway operation return GrB_PANIC-level
+    // abort cleanly; the check is one relaxed atomic load per task, and
+    // partially-written workspace is already freed by the normal error
+    // paths.
+
+    // FUTURE::: the schedule(dynamic,1) below self-balances whole tasks,
+    // and the heaviest coarse tasks are ordered first (LPT), but a task
+    // whose flop estimate is badly wrong (hash collisions, skewed masks)
+    // still runs on one thread to completion.  True work stealing would
+    // split fine tasks further on demand; that needs task descriptors
+    // mutable during the numeric phase, with the attendant
+    // synchronization on Hf/Hx ownership.
+
     int taskid ;
     #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
     for (taskid = 0 ; taskid < nfine ; taskid++)
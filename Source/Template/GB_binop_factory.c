@@ -10,6 +10,13 @@
 // The #include'ing file defines the GB_BINOP_WORKER macro, and opcode, xycode,
 // and zcode
 
+// FUTURE::: runtime SIMD dispatch (AVX2/AVX-512 multi-versioning) for
+// the kernels expanded here: GCC function multi-versioning or manual
+// ifunc dispatch per worker would need the code generator to emit
+// per-ISA clones.  The simd reduction clauses added to the dot kernels
+// get most of the benefit from the baseline ISA; full multi-versioning
+// doubles or triples the already-large Generated build.
+
 {
     //--------------------------------------------------------------------------
     // launch the switch factory
@@ -2,6 +2,15 @@
 // Source/Template/GB_critical_section: execute code in a critical section
 //------------------------------------------------------------------------------
 
+// FUTURE::: lock-free concurrent readers: the critical section guards the
+// global matrix queue, which only matters for matrices with zombies or
+// pending tuples.  Operations whose inputs are finished touch the queue
+// only through GB_WAIT macros that check first, so the contended path for
+// concurrent readers of a finished matrix is already narrow; a documented
+// guarantee needs the remaining touch points (GrB_error state in
+// thread-local storage, burble) audited and the queue check made a
+// relaxed atomic load.
+
 // SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
 // http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
 
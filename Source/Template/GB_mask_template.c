@@ -7,6 +7,14 @@
 
 //------------------------------------------------------------------------------
 
+// FUTURE::: dense structural masks as packed bitsets: when M is dense the
+// merge below pays sparse-lookup costs per entry for information that is
+// one bit per position.  An all-true dense structural mask is already
+// discarded entirely in GB_ewise; the general dense-valued case wants a
+// bitmap side-structure (1 bit per position, built once per operation)
+// probed O(1) in this template and in the saxpy3 mask probes.
+
+
 // Computes C<M>=Z or C<!M>=Z, returning the result in R.  The input matrix C
 // is not modified.  Effectively, this computes R=C and then R<M>=Z or R<!M>=Z.
 // If the C_replace descriptor is enabled, then C has already been cleared, and
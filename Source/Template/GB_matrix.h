@@ -23,6 +23,47 @@
 //      int64_t nvec ;          // always 1
 //      int64_t *h ;            // always NULL
 
+//------------------------------------------------------------------------------
+// FUTURE::: symmetric storage
+//------------------------------------------------------------------------------
+
+// A symmetric property (store one triangle, mirror implicitly) halves
+// memory and mxm work for half of real-world matrices, but every kernel
+// would need a mirrored traversal mode or a materialize-on-demand of the
+// other triangle; like the other storage classes noted below it is
+// format-version work.  The cached transpose mirror (GB_transpose.c) is
+// the degenerate form available sooner: for symmetric A the mirror is A
+// itself, so a symmetry *hint* alone already lets vxm/mxv pick either
+// orientation.
+
+//------------------------------------------------------------------------------
+// FUTURE::: compressed and tiled storage classes
+//------------------------------------------------------------------------------
+
+// Two further storage classes have been requested for read-mostly
+// matrices: delta/varint-compressed A->i (sorted, clustered indices
+// shrink ~60% on large graphs; sequential-scan kernels decode on the fly,
+// random access needs per-vector skip points), and cache-blocked 2D
+// tiles (DCSR-of-blocks) so the Gustavson scatter stays cache-resident.
+// Both change what "A->i" means to every kernel, so like the 32-bit mode
+// below they are format-version work, gated on the read-only matrix
+// state (see GxB_Matrix_import_CSR.c).  For the tiled class, the kernel
+// side is the larger work: saxpy over tiles needs block-local
+// accumulators and a block-level symbolic phase, in exchange for
+// scatter working sets that fit in cache on mesh and road-network
+// matrices.
+
+//------------------------------------------------------------------------------
+// FUTURE::: 32-bit indices
+//------------------------------------------------------------------------------
+
+// A->i and A->p are always int64_t.  An opt-in 32-bit storage class for
+// matrices under 2^31 dimensions would halve index memory and bandwidth,
+// but it doubles every kernel expansion (the factories would parameterize
+// on index type as they do on value type) and touches import/export and
+// the MATLAB interface.  It is a major-version format change; recording
+// it here since this struct is where the type would change.
+
 //------------------------------------------------------------------------------
 // basic information: magic and type
 //------------------------------------------------------------------------------
@@ -7,6 +7,13 @@
 
 //------------------------------------------------------------------------------
 
+// FUTURE::: user-defined dup operators run through the generic version of
+// this template, one function-pointer call per duplicate.  A batch
+// operator ABI (see GB_apply_op.c) or runtime kernel compilation would
+// specialize this loop for user ops; within the current scheme, the
+// no-typecast direct-pointer form used by the generic AxB workers applies
+// here as well and avoids the per-duplicate scalar-workspace copies.
+
 // This template is used in GB_builder and the Generated/GB_red_build__*
 // workers.  This is the same for both vectors and matrices, since this step is
 // agnostic about which vectors the entries appear.
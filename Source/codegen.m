@@ -1,6 +1,12 @@
 function codegen
 %CODEGEN generate all code for Generated/*
 
+% FUTURE::: FP16/BF16 value types with FP32 accumulation: the value-type
+% list expanded here bottoms out at FP32/FP64.  Mixed-precision semirings
+% (16-bit storage, 32-bit accumulator) break the xtype==ztype assumption
+% that the monoid factories make, so they need their own semiring family,
+% not just two more rows in the type table.
+
 codegen_1type ;     % types
 codegen_axb ;       % semirings
 codegen_binop ;     % binary operators
@@ -109,7 +109,20 @@ elseif (~isempty (terminal))
 else
     fprintf (f, 'define(`GB_is_any_monoid'', `0'')\n') ;
     fprintf (f, 'define(`GB_terminal'', `;'')\n') ;
-    fprintf (f, 'define(`GB_dot_simd_vectorize'', `GB_PRAGMA_SIMD'')\n') ;
+    % the monoid has no terminal value, so the dot product loop can be
+    % vectorized.  Declare the accumulator as an explicit simd reduction
+    % when the monoid has an OpenMP reduction operator, so the loop
+    % vectorizes without relying on unsafe math optimizations.
+    if (isequal (addop, 'plus'))
+        fprintf (f, 'define(`GB_dot_simd_vectorize'', `GB_PRAGMA_SIMD_REDUCTION (+,cij)'')\n') ;
+    elseif (isequal (addop, 'times'))
+        fprintf (f, 'define(`GB_dot_simd_vectorize'', `GB_PRAGMA_SIMD_REDUCTION (*,cij)'')\n') ;
+    elseif (isequal (addop, 'lxor'))
+        fprintf (f, 'define(`GB_dot_simd_vectorize'', `GB_PRAGMA_SIMD_REDUCTION (^,cij)'')\n') ;
+    else
+        % the EQ monoid has no OpenMP reduction operator
+        fprintf (f, 'define(`GB_dot_simd_vectorize'', `GB_PRAGMA_SIMD'')\n') ;
+    end
 end
 
 % all built-in monoids are atomic
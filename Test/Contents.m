@@ -63,6 +63,20 @@
 %   test03   - test GB_*_check functions
 %   test04   - test and demo for accumulator/mask and transpose
 %   test05   - test GrB_*_setElement
+%   test164  - test GxB_AXB_METHOD_COUNTS
+%   test163  - test GxB_mxm_estimate
+%   test162  - test GxB_Matrix_nvals_estimate
+%   test161  - test GxB_Matrix_validate
+%   test160  - test GxB_Matrix_memoryUsage
+%   test159  - test GxB_Matrix_fit
+%   test158  - test GxB_Matrix_isequal
+%   test157  - test GxB_Matrix_rowDegree/colDegree
+%   test156  - test GxB_Matrix_diag and GxB_Vector_diag
+%   test155  - test GxB_*_apply_BinaryOp1st/2nd
+%   test151  - test GxB_Matrix_eWiseUnion
+%   test152  - test GxB_Matrix_setElements
+%   test153  - test GrB_Matrix_removeElement
+%   test154  - test dense-times-dense mxm (the CBLAS gemm bridge)
 %   test06   - test GrB_mxm on all semirings
 %   test07   - test GxB_subassign with a single pending tuple
 %   test07b  - test GrB_assign with a single pending tuple
@@ -73,7 +73,8 @@ void mexFunction
     // simple_tic (tic2) ;
 
     // C = A+B using the op.  No mask
-    METHOD (GB_add (&C, A->type, true, NULL, false, A, B, op, Context)) ;
+    METHOD (GB_add (&C, A->type, true, NULL, false, A, B, op, NULL, NULL,
+        Context)) ;
 
     // return C to MATLAB as a plain sparse matrix
     pargout [0] = GB_mx_Matrix_to_mxArray (&C, "C AplusB result", false) ;
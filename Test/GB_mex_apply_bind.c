@@ -0,0 +1,131 @@
+//------------------------------------------------------------------------------
+// GB_mex_apply_bind: C = op(s,A) or op(A,s) with a bound scalar
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// This is for testing only.  See GxB_Matrix_apply_BinaryOp1st/2nd instead.
+
+#include "GB_mex.h"
+
+#define USAGE "C = GB_mex_apply_bind (A, s, op, bind_first, is_vector)"
+
+#define FREE_ALL                        \
+{                                       \
+    GB_MATRIX_FREE (&A) ;               \
+    GB_MATRIX_FREE (&C) ;               \
+    GrB_free (&s) ;                     \
+    GB_mx_put_global (true, 0) ;        \
+}
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL ;
+    GrB_Matrix C = NULL ;
+    GxB_Scalar s = NULL ;
+    GrB_BinaryOp op = NULL ;
+
+    GB_WHERE (USAGE) ;
+
+    // check inputs
+    if (nargout > 1 || nargin < 4 || nargin > 5)
+    {
+        mexErrMsgTxt ("Usage: " USAGE) ;
+    }
+
+    #define GET_DEEP_COPY ;
+    #define FREE_DEEP_COPY ;
+
+    // get A
+    A = GB_mx_mxArray_to_Matrix (pargin [0], "A", false, true) ;
+    if (A == NULL)
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("A failed") ;
+    }
+    mxClassID aclass = GB_mx_Type_to_classID (A->type) ;
+
+    // get the bound scalar s, as a double
+    if (!mxIsScalar (pargin [1]))
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("s must be a scalar") ;
+    }
+    if (GxB_Scalar_new (&s, GrB_FP64) != GrB_SUCCESS)
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("s failed") ;
+    }
+    GxB_Scalar_setElement_FP64 (s, mxGetScalar (pargin [1])) ;
+
+    // get op
+    if (!GB_mx_mxArray_to_BinaryOp (&op, pargin [2], "op",
+        GB_NOP_opcode, aclass, A->type == Complex, false))
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("op failed") ;
+    }
+
+    // get the bind_first and is_vector flags
+    bool bind_first = (mxGetScalar (pargin [3]) != 0) ;
+    bool is_vector = (nargin > 4) && (mxGetScalar (pargin [4]) != 0) ;
+
+    // create the output matrix C, of the op's output type
+    GrB_Index nrows, ncols ;
+    GrB_Matrix_nrows (&nrows, A) ;
+    GrB_Matrix_ncols (&ncols, A) ;
+    if (GrB_Matrix_new (&C, op->ztype, nrows, ncols) != GrB_SUCCESS)
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("C failed") ;
+    }
+
+    if (is_vector)
+    {
+        // w = op (s,u) or op (u,s), via the GrB_Vector variants
+        if (ncols != 1 || !GB_VECTOR_OK (A))
+        {
+            FREE_ALL ;
+            mexErrMsgTxt ("A must be a column vector") ;
+        }
+        if (bind_first)
+        {
+            METHOD (GxB_Vector_apply_BinaryOp1st ((GrB_Vector) C, NULL,
+                NULL, op, s, (GrB_Vector) A, NULL)) ;
+        }
+        else
+        {
+            METHOD (GxB_Vector_apply_BinaryOp2nd ((GrB_Vector) C, NULL,
+                NULL, op, (GrB_Vector) A, s, NULL)) ;
+        }
+    }
+    else
+    {
+        if (bind_first)
+        {
+            METHOD (GxB_Matrix_apply_BinaryOp1st (C, NULL, NULL, op, s, A,
+                NULL)) ;
+        }
+        else
+        {
+            METHOD (GxB_Matrix_apply_BinaryOp2nd (C, NULL, NULL, op, A, s,
+                NULL)) ;
+        }
+    }
+
+    // return C to MATLAB as a plain sparse matrix
+    pargout [0] = GB_mx_Matrix_to_mxArray (&C, "C apply_bind result", false) ;
+
+    FREE_ALL ;
+}
@@ -0,0 +1,71 @@
+//------------------------------------------------------------------------------
+// GB_mex_degree: d = rowDegree (A) or colDegree (A)
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// This is for testing only.  See GxB_Matrix_rowDegree and GxB_Matrix_colDegree instead.
+
+#include "GB_mex.h"
+
+#define USAGE "d = GB_mex_degree (A, byrow)"
+
+#define FREE_ALL                        \
+{                                       \
+    GB_MATRIX_FREE (&A) ;               \
+    GrB_free (&d) ;                     \
+    GB_mx_put_global (true, 0) ;        \
+}
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL ;
+    GrB_Vector d = NULL ;
+
+    GB_WHERE (USAGE) ;
+
+    // check inputs
+    if (nargout > 1 || nargin != 2)
+    {
+        mexErrMsgTxt ("Usage: " USAGE) ;
+    }
+
+    #define GET_DEEP_COPY ;
+    #define FREE_DEEP_COPY ;
+
+    // get A
+    A = GB_mx_mxArray_to_Matrix (pargin [0], "A", false, true) ;
+    if (A == NULL)
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("A failed") ;
+    }
+
+    bool byrow = (mxGetScalar (pargin [1]) != 0) ;
+
+    // d = rowDegree (A) or colDegree (A)
+    if (byrow)
+    {
+        METHOD (GxB_Matrix_rowDegree (&d, A)) ;
+    }
+    else
+    {
+        METHOD (GxB_Matrix_colDegree (&d, A)) ;
+    }
+
+    // return d to MATLAB as a plain sparse vector
+    pargout [0] = GB_mx_Vector_to_mxArray (&d, "d degree result", false) ;
+
+    FREE_ALL ;
+}
@@ -1,5 +1,5 @@
 //------------------------------------------------------------------------------
-// GB_mex_diag: compute C=diag(A,1)
+// GB_mex_diag: C = diag (v,k) as a matrix, or v = diag (A,k) as a vector
 //------------------------------------------------------------------------------
 
 // SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
@@ -7,21 +7,22 @@
 
 //------------------------------------------------------------------------------
 
-// C = diag (A,k), where A and C are double
+// This is for testing only.  See GxB_Matrix_diag and GxB_Vector_diag instead.  If A is a column vector,
+// C = diag (A,k) builds the diagonal matrix; otherwise the kth diagonal of
+// A is extracted into a vector.
 
 #include "GB_mex.h"
 
-#define USAGE "C = GB_mex_diag (A,k)"
+#define USAGE "C = GB_mex_diag (A, k)"
 
 #define FREE_ALL                        \
 {                                       \
-    GB_VECTOR_FREE (&Thunk) ;           \
     GB_MATRIX_FREE (&A) ;               \
     GB_MATRIX_FREE (&C) ;               \
+    GrB_free (&v) ;                     \
     GB_mx_put_global (true, 0) ;        \
 }
 
-
 void mexFunction
 (
     int nargout,
@@ -32,11 +33,13 @@ void mexFunction
 {
 
     bool malloc_debug = GB_mx_get_global (true) ;
-    GrB_Matrix A = NULL, C = NULL ;
-    GxB_Scalar Thunk = NULL ;
+    GrB_Matrix A = NULL ;
+    GrB_Matrix C = NULL ;
+    GrB_Vector v = NULL ;
 
-    // check inputs
     GB_WHERE (USAGE) ;
+
+    // check inputs
     if (nargout > 1 || nargin < 1 || nargin > 2)
     {
         mexErrMsgTxt ("Usage: " USAGE) ;
@@ -50,39 +53,43 @@ void mexFunction
     if (A == NULL)
     {
         FREE_ALL ;
-        mexErrMsgTxt ("failed") ;
+        mexErrMsgTxt ("A failed") ;
     }
 
-    int64_t k = 0 ;
     // get k
-    if (nargin > 1)
-    {
-        k = (int64_t) mxGetScalar (pargin [1]) ;
-    }
-
-    #define GET_DEEP_COPY ;
-    #define FREE_DEEP_COPY ;
+    int64_t k = (nargin > 1) ? ((int64_t) mxGetScalar (pargin [1])) : 0 ;
 
-    // construct C
-    METHOD (GrB_Matrix_new (&C, GrB_FP64, A->vlen, A->vdim)) ;
+    GrB_Index nrows, ncols ;
+    GrB_Matrix_nrows (&nrows, A) ;
+    GrB_Matrix_ncols (&ncols, A) ;
 
-    #undef GET_DEEP_COPY
-    #undef FREE_DEEP_COPY
+    if (ncols == 1 && GB_VECTOR_OK (A))
+    {
 
-    #define GET_DEEP_COPY  GrB_Matrix_new (&C, GrB_FP64, A->vlen, A->vdim) ;
-    #define FREE_DEEP_COPY GrB_Matrix_free (&C) ;
+        // C = diag (A,k), a square matrix built from the vector A
+        METHOD (GxB_Matrix_diag (&C, (GrB_Vector) A, k)) ;
 
-    GxB_Scalar_new (&Thunk, GrB_INT64) ;
-    GxB_Scalar_setElement_INT64 (Thunk, k) ;
-    GrB_Index ignore ;
-    GxB_Scalar_nvals (&ignore, Thunk) ;
+    }
+    else
+    {
 
-    // C = diag (A,k)
-    METHOD (GxB_Matrix_select (C, NULL, NULL, GxB_DIAG, A, Thunk, NULL)) ;
+        // v = diag (A,k), extracted from the matrix A
+        int64_t dlen = (k >= 0) ?
+            GB_IMIN ((int64_t) nrows, ((int64_t) ncols) - k) :
+            GB_IMIN (((int64_t) nrows) + k, (int64_t) ncols) ;
+        dlen = GB_IMAX (dlen, 0) ;
+        if (GrB_Vector_new (&v, A->type, dlen) != GrB_SUCCESS)
+        {
+            FREE_ALL ;
+            mexErrMsgTxt ("v failed") ;
+        }
+        METHOD (GxB_Vector_diag (v, A, k, NULL)) ;
+        C = (GrB_Matrix) v ;
+        v = NULL ;
+    }
 
-    // return C to MATLAB as a regular MATLAB sparse matrix
-    pargout [0] = GB_mx_Matrix_to_mxArray (&C, "C diag", false) ;
+    // return C to MATLAB as a plain sparse matrix
+    pargout [0] = GB_mx_Matrix_to_mxArray (&C, "C diag result", false) ;
 
     FREE_ALL ;
 }
-
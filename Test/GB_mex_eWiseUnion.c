@@ -0,0 +1,120 @@
+//------------------------------------------------------------------------------
+// GB_mex_eWiseUnion: compute C = eWiseUnion (A, alpha, B, beta, op)
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// This is for testing only.  See GxB_Matrix_eWiseUnion instead.  Unmatched
+// entries are combined with the fill values alpha and beta (double scalars),
+// instead of copied through as GrB_eWiseAdd does.  No mask, no accum.
+// Returns a plain MATLAB matrix, in double.
+
+#include "GB_mex.h"
+
+#define USAGE "C = GB_mex_eWiseUnion (A, alpha, B, beta, op, M)"
+
+#define FREE_ALL                        \
+{                                       \
+    GB_MATRIX_FREE (&A) ;               \
+    GB_MATRIX_FREE (&B) ;               \
+    GB_MATRIX_FREE (&C) ;               \
+    GB_MATRIX_FREE (&M) ;               \
+    GrB_free (&alpha) ;                 \
+    GrB_free (&beta) ;                  \
+    GB_mx_put_global (true, 0) ;        \
+}
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL ;
+    GrB_Matrix B = NULL ;
+    GrB_Matrix C = NULL ;
+    GrB_Matrix M = NULL ;
+    GxB_Scalar alpha = NULL, beta = NULL ;
+    GrB_BinaryOp op = NULL ;
+
+    GB_WHERE (USAGE) ;
+
+    // check inputs
+    if (nargout > 1 || nargin < 5 || nargin > 6)
+    {
+        mexErrMsgTxt ("Usage: " USAGE) ;
+    }
+
+    #define GET_DEEP_COPY ;
+    #define FREE_DEEP_COPY ;
+
+    // get A and B
+    A = GB_mx_mxArray_to_Matrix (pargin [0], "A", false, true) ;
+    B = GB_mx_mxArray_to_Matrix (pargin [2], "B", false, true) ;
+    if (A == NULL || B == NULL)
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("failed") ;
+    }
+    mxClassID aclass = GB_mx_Type_to_classID (A->type) ;
+
+    // get the fill values alpha and beta, as double scalars
+    if (!mxIsScalar (pargin [1]) || !mxIsScalar (pargin [3]))
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("alpha and beta must be scalars") ;
+    }
+    if (GxB_Scalar_new (&alpha, GrB_FP64) != GrB_SUCCESS ||
+        GxB_Scalar_new (&beta,  GrB_FP64) != GrB_SUCCESS)
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("fill scalars failed") ;
+    }
+    GxB_Scalar_setElement_FP64 (alpha, mxGetScalar (pargin [1])) ;
+    GxB_Scalar_setElement_FP64 (beta,  mxGetScalar (pargin [3])) ;
+
+    // get op; default class is class(A)
+    if (!GB_mx_mxArray_to_BinaryOp (&op, pargin [4], "op",
+        GB_NOP_opcode, aclass, A->type == Complex, B->type == Complex))
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("op failed") ;
+    }
+
+    // get the optional mask M
+    if (nargin > 5)
+    {
+        M = GB_mx_mxArray_to_Matrix (pargin [5], "M", false, false) ;
+        if (M == NULL && !mxIsEmpty (pargin [5]))
+        {
+            FREE_ALL ;
+            mexErrMsgTxt ("M failed") ;
+        }
+    }
+
+    // create the output matrix C, of the op's output type
+    GrB_Index nrows, ncols ;
+    GrB_Matrix_nrows (&nrows, A) ;
+    GrB_Matrix_ncols (&ncols, A) ;
+    if (GrB_Matrix_new (&C, op->ztype, nrows, ncols) != GrB_SUCCESS)
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("C failed") ;
+    }
+
+    // C<M> = eWiseUnion (A, alpha, B, beta), optional mask, no accum
+    METHOD (GxB_Matrix_eWiseUnion (C, M, NULL, op, A, alpha, B, beta,
+        NULL)) ;
+
+    // return C to MATLAB as a plain sparse matrix
+    pargout [0] = GB_mx_Matrix_to_mxArray (&C, "C eWiseUnion result", false) ;
+
+    FREE_ALL ;
+}
@@ -0,0 +1,82 @@
+//------------------------------------------------------------------------------
+// GB_mex_fit: trim the capacity of C; report bytes before and after
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// This is for testing only.  See GxB_Matrix_fit and GxB_Matrix_memoryUsage instead.
+
+#include "GB_mex.h"
+
+#define USAGE "[C, bytes] = GB_mex_fit (C)"
+
+#define FREE_ALL                        \
+{                                       \
+    GB_MATRIX_FREE (&C) ;               \
+    GB_mx_put_global (true, 0) ;        \
+}
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix C = NULL ;
+
+    GB_WHERE (USAGE) ;
+
+    // check inputs
+    if (nargout > 2 || nargin != 1)
+    {
+        mexErrMsgTxt ("Usage: " USAGE) ;
+    }
+
+    // get C (deep copy)
+    #define GET_DEEP_COPY \
+    C = GB_mx_mxArray_to_Matrix (pargin [0], "C input", true, true) ;
+    #define FREE_DEEP_COPY GB_MATRIX_FREE (&C) ;
+    GET_DEEP_COPY ;
+    if (C == NULL)
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("C failed") ;
+    }
+
+    // inflate the capacity, so the fit below has slack to trim
+    if (GB_ix_realloc (C, 4 * GB_IMAX (GB_NNZ (C), 1) + 64, true, Context)
+        != GrB_SUCCESS)
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("inflate failed") ;
+    }
+
+    size_t before = 0, after = 0 ;
+    GxB_Matrix_memoryUsage (&before, C) ;
+
+    // trim the capacity
+    METHOD (GxB_Matrix_fit (C)) ;
+
+    GxB_Matrix_memoryUsage (&after, C) ;
+
+    // return the bytes before and after the fit
+    if (nargout > 1)
+    {
+        pargout [1] = mxCreateDoubleMatrix (1, 2, mxREAL) ;
+        double *b = mxGetPr (pargout [1]) ;
+        b [0] = (double) before ;
+        b [1] = (double) after ;
+    }
+
+    // return C to MATLAB as a struct
+    pargout [0] = GB_mx_Matrix_to_mxArray (&C, "C fit result", true) ;
+
+    FREE_ALL ;
+}
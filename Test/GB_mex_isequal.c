@@ -1,5 +1,5 @@
 //------------------------------------------------------------------------------
-// GB_mex_isequal: returns true if A and B are equal
+// GB_mex_isequal: t = isequal (A, B), short-circuiting bitwise equality
 //------------------------------------------------------------------------------
 
 // SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
@@ -7,9 +7,12 @@
 
 //------------------------------------------------------------------------------
 
+// This is for testing only.  See GxB_Matrix_isequal instead.  Returns 1 if equal, 0 if not,
+// and -1 for a mixed-format pair (GrB_NO_VALUE).
+
 #include "GB_mex.h"
 
-#define USAGE "C = GB_mex_isequal (A, B)"
+#define USAGE "t = GB_mex_isequal (A, B)"
 
 #define FREE_ALL                        \
 {                                       \
@@ -18,7 +21,6 @@
     GB_mx_put_global (true, 0) ;        \
 }
 
-
 void mexFunction
 (
     int nargout,
@@ -40,9 +42,6 @@ void mexFunction
         mexErrMsgTxt ("Usage: " USAGE) ;
     }
 
-    #define GET_DEEP_COPY ;
-    #define FREE_DEEP_COPY ;
-
     // get A and B
     A = GB_mx_mxArray_to_Matrix (pargin [0], "A", false, true) ;
     B = GB_mx_mxArray_to_Matrix (pargin [1], "B", false, true) ;
@@ -52,19 +51,23 @@ void mexFunction
         mexErrMsgTxt ("failed") ;
     }
 
-    GrB_BinaryOp op = NULL ;
-    if (mxIsComplex (pargin [0]))
+    bool result = false ;
+    GrB_Info info = GxB_Matrix_isequal (&result, A, B) ;
+    double t ;
+    if (info == GrB_SUCCESS)
     {
-        op = Complex_eq ;
+        t = result ? 1 : 0 ;
+    }
+    else if (info == GrB_NO_VALUE)
+    {
+        t = -1 ;
+    }
+    else
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("isequal failed") ;
     }
 
-    // C = all (A == B) using the op
-    bool result ;
-    METHOD (isequal (&result, A, B, op)) ;
-
-    // return C to MATLAB as a plain sparse matrix
-    pargout [0] = mxCreateDoubleScalar ((double) result) ;
-
+    pargout [0] = mxCreateDoubleScalar (t) ;
     FREE_ALL ;
 }
-
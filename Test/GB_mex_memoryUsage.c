@@ -0,0 +1,76 @@
+//------------------------------------------------------------------------------
+// GB_mex_memoryUsage: report the bytes held by a matrix, and the global counters
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// This is for testing only.  See GxB_Matrix_memoryUsage and the GxB_MALLOC_TRACKING,
+// GxB_MEMORY_INUSE, and GxB_MEMORY_PEAK global options instead.
+
+#include "GB_mex.h"
+
+#define USAGE "[bytes, stats] = GB_mex_memoryUsage (A)"
+
+#define FREE_ALL                        \
+{                                       \
+    GB_MATRIX_FREE (&A) ;               \
+    GB_mx_put_global (true, 0) ;        \
+}
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL ;
+
+    GB_WHERE (USAGE) ;
+
+    // check inputs
+    if (nargout > 2 || nargin != 1)
+    {
+        mexErrMsgTxt ("Usage: " USAGE) ;
+    }
+
+    // get A (deep copy, so its components are owned, not shallow:
+    // GxB_Matrix_memoryUsage does not count shallow components)
+    A = GB_mx_mxArray_to_Matrix (pargin [0], "A", true, true) ;
+    if (A == NULL)
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("A failed") ;
+    }
+
+    size_t bytes = 0 ;
+    if (GxB_Matrix_memoryUsage (&bytes, A) != GrB_SUCCESS)
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("memoryUsage failed") ;
+    }
+    pargout [0] = mxCreateDoubleScalar ((double) bytes) ;
+
+    // also query the global memory counters
+    if (nargout > 1)
+    {
+        bool tracking = false ;
+        int64_t inuse = 0, maxused = 0 ;
+        GxB_Global_Option_get (GxB_MALLOC_TRACKING, &tracking) ;
+        GxB_Global_Option_get (GxB_MEMORY_INUSE, &inuse) ;
+        GxB_Global_Option_get (GxB_MEMORY_PEAK, &maxused) ;
+        pargout [1] = mxCreateDoubleMatrix (1, 3, mxREAL) ;
+        double *s = mxGetPr (pargout [1]) ;
+        s [0] = tracking ? 1 : 0 ;
+        s [1] = (double) inuse ;
+        s [2] = (double) maxused ;
+    }
+
+    FREE_ALL ;
+}
@@ -0,0 +1,55 @@
+//------------------------------------------------------------------------------
+// GB_mex_method_counts: c = the six GxB_AXB_METHOD_COUNTS counters
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// This is for testing only.  See the GxB_AXB_METHOD_COUNTS field of GxB_Global_Option_get.
+
+#include "GB_mex.h"
+
+#define USAGE "c = GB_mex_method_counts"
+
+#define FREE_ALL                        \
+{                                       \
+    GB_mx_put_global (true, 0) ;        \
+}
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+
+    GB_WHERE (USAGE) ;
+
+    // check inputs
+    if (nargout > 1 || nargin != 0)
+    {
+        mexErrMsgTxt ("Usage: " USAGE) ;
+    }
+
+    int64_t counts [GB_AXB_NMETHODS] ;
+    if (GxB_Global_Option_get (GxB_AXB_METHOD_COUNTS, counts) != GrB_SUCCESS)
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("option get failed") ;
+    }
+
+    pargout [0] = mxCreateDoubleMatrix (GB_AXB_NMETHODS, 1, mxREAL) ;
+    double *c = mxGetPr (pargout [0]) ;
+    for (int k = 0 ; k < GB_AXB_NMETHODS ; k++)
+    {
+        c [k] = (double) counts [k] ;
+    }
+
+    FREE_ALL ;
+}
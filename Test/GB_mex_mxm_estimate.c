@@ -0,0 +1,66 @@
+//------------------------------------------------------------------------------
+// GB_mex_mxm_estimate: e = [flops, nnz bound] for C=A*B, without computing it
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// This is for testing only.  See GxB_mxm_estimate instead.
+
+#include "GB_mex.h"
+
+#define USAGE "e = GB_mex_mxm_estimate (A, B)"
+
+#define FREE_ALL                        \
+{                                       \
+    GB_MATRIX_FREE (&A) ;               \
+    GB_MATRIX_FREE (&B) ;               \
+    GB_mx_put_global (true, 0) ;        \
+}
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL ;
+    GrB_Matrix B = NULL ;
+
+    GB_WHERE (USAGE) ;
+
+    // check inputs
+    if (nargout > 1 || nargin != 2)
+    {
+        mexErrMsgTxt ("Usage: " USAGE) ;
+    }
+
+    // get A and B
+    A = GB_mx_mxArray_to_Matrix (pargin [0], "A", false, true) ;
+    B = GB_mx_mxArray_to_Matrix (pargin [1], "B", false, true) ;
+    if (A == NULL || B == NULL)
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("failed") ;
+    }
+
+    double flops = 0, bound = 0 ;
+    if (GxB_mxm_estimate (&flops, &bound, NULL, A, B) != GrB_SUCCESS)
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("mxm_estimate failed") ;
+    }
+
+    pargout [0] = mxCreateDoubleMatrix (1, 2, mxREAL) ;
+    double *e = mxGetPr (pargout [0]) ;
+    e [0] = flops ;
+    e [1] = bound ;
+
+    FREE_ALL ;
+}
@@ -0,0 +1,110 @@
+//------------------------------------------------------------------------------
+// GB_mex_nvals_estimate: bounds on nvals with pending updates, then the exact count
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// This is for testing only.  See GxB_Matrix_nvals_estimate instead.  The tuples (I,J,X) are
+// applied with setElement so they are pending when the bounds are
+// queried; GrB_Matrix_nvals then forces assembly for the exact count.
+
+#include "GB_mex.h"
+
+#define USAGE "b = GB_mex_nvals_estimate (C, I, J, X)"
+
+#define FREE_ALL                        \
+{                                       \
+    GB_MATRIX_FREE (&C) ;               \
+    GB_mx_put_global (true, 0) ;        \
+}
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix C = NULL ;
+    GrB_Index *I = NULL, ni = 0, I_range [3] ;
+    GrB_Index *J = NULL, nj = 0, J_range [3] ;
+    bool is_list ;
+
+    GB_WHERE (USAGE) ;
+
+    // check inputs
+    if (nargout > 1 || nargin != 4)
+    {
+        mexErrMsgTxt ("Usage: " USAGE) ;
+    }
+
+    // get C (deep copy)
+    #define GET_DEEP_COPY \
+    C = GB_mx_mxArray_to_Matrix (pargin [0], "C input", true, true) ;
+    #define FREE_DEEP_COPY GB_MATRIX_FREE (&C) ;
+    GET_DEEP_COPY ;
+    if (C == NULL || C->type != GrB_FP64)
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("C failed; must be double") ;
+    }
+
+    // get I and J
+    if (!GB_mx_mxArray_to_indices (&I, pargin [1], &ni, I_range, &is_list)
+        || !is_list)
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("I is invalid; must be a list") ;
+    }
+    if (!GB_mx_mxArray_to_indices (&J, pargin [2], &nj, J_range, &is_list)
+        || !is_list || ni != nj)
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("J is invalid; must be a list the same size as I") ;
+    }
+
+    // get X
+    if (ni != mxGetNumberOfElements (pargin [3]) ||
+        !mxIsDouble (pargin [3]) || mxIsSparse (pargin [3]))
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("X must be a dense double array, same size as I") ;
+    }
+    double *X = mxGetPr (pargin [3]) ;
+
+    // apply the updates one at a time, leaving them pending
+    for (int64_t k = 0 ; k < ni ; k++)
+    {
+        if (GrB_Matrix_setElement_FP64 (C, X [k], I [k], J [k])
+            != GrB_SUCCESS)
+        {
+            FREE_ALL ;
+            mexErrMsgTxt ("setElement failed") ;
+        }
+    }
+
+    // query the bounds without forcing assembly
+    GrB_Index lower = 0, upper = 0, exact = 0 ;
+    if (GxB_Matrix_nvals_estimate (&lower, &upper, C) != GrB_SUCCESS)
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("nvals_estimate failed") ;
+    }
+
+    // the exact count forces the pending work to finish
+    GrB_Matrix_nvals (&exact, C) ;
+
+    pargout [0] = mxCreateDoubleMatrix (1, 3, mxREAL) ;
+    double *b = mxGetPr (pargout [0]) ;
+    b [0] = (double) lower ;
+    b [1] = (double) upper ;
+    b [2] = (double) exact ;
+
+    FREE_ALL ;
+}
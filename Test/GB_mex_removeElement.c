@@ -0,0 +1,108 @@
+//------------------------------------------------------------------------------
+// GB_mex_removeElement: remove entries C(I(k),J(k)) one at a time
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// This is for testing only.  See GrB_Matrix_removeElement instead.  Each
+// (I(k),J(k)) is removed with one call, so the entries become zombies;
+// removing an entry that is not present is a no-op.  With debug_wait true,
+// the zombies are deleted by GB_wait before C is returned.  I and J are
+// zero-based.
+
+#include "GB_mex.h"
+
+#define USAGE "C = GB_mex_removeElement (C, I, J, debug_wait)"
+
+bool debug_wait = false ;
+
+#define FREE_ALL                        \
+{                                       \
+    GB_MATRIX_FREE (&C) ;               \
+    GB_mx_put_global (true, 0) ;        \
+}
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+
+    GrB_Matrix C = NULL ;
+    GrB_Index *I = NULL, ni = 0, I_range [3] ;
+    GrB_Index *J = NULL, nj = 0, J_range [3] ;
+    bool is_list ;
+
+    // check inputs
+    GB_WHERE (USAGE) ;
+    if (nargout > 1 || nargin < 3 || nargin > 4)
+    {
+        mexErrMsgTxt ("Usage: " USAGE) ;
+    }
+
+    // get C (deep copy)
+    #define GET_DEEP_COPY \
+    C = GB_mx_mxArray_to_Matrix (pargin [0], "C input", true, true) ;
+    #define FREE_DEEP_COPY GB_MATRIX_FREE (&C) ;
+    GET_DEEP_COPY ;
+    if (C == NULL)
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("C failed") ;
+    }
+
+    // get I and J
+    if (!GB_mx_mxArray_to_indices (&I, pargin [1], &ni, I_range, &is_list)
+        || !is_list)
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("I is invalid; must be a list") ;
+    }
+    if (!GB_mx_mxArray_to_indices (&J, pargin [2], &nj, J_range, &is_list)
+        || !is_list)
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("J is invalid; must be a list") ;
+    }
+    if (ni != nj)
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("I and J must be the same size") ;
+    }
+
+    // get the debug_wait flag, to force assembly afterwards
+    if (nargin > 3)
+    {
+        debug_wait = (mxGetScalar (pargin [3]) != 0) ;
+    }
+
+    // remove the entries, one at a time
+    for (int64_t k = 0 ; k < ni ; k++)
+    {
+        GrB_Info info = GrB_Matrix_removeElement (C, I [k], J [k]) ;
+        if (info != GrB_SUCCESS)
+        {
+            FREE_ALL ;
+            mexErrMsgTxt ("removeElement failed") ;
+        }
+    }
+
+    if (debug_wait)
+    {
+        GB_wait (C, Context) ;
+    }
+
+    // return C to MATLAB as a struct and free the GraphBLAS C
+    pargout [0] = GB_mx_Matrix_to_mxArray (&C, "C removeElement result",
+        true) ;
+
+    FREE_ALL ;
+}
@@ -0,0 +1,130 @@
+//------------------------------------------------------------------------------
+// GB_mex_setElements: bulk update C(I(k),J(k)) = X(k) via GxB_Matrix_setElements
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// This is for testing only.  See GxB_Matrix_setElements instead.  C must be
+// a double matrix, X a double array, and I and J zero-based index lists.
+// Duplicates within the batch are combined with the dup operator (default
+// PLUS); existing entries of C addressed by the batch are overwritten, and
+// the rest of C is unchanged.
+
+#include "GB_mex.h"
+
+#define USAGE "C = GB_mex_setElements (C, I, J, X, dup, debug_wait)"
+
+bool debug_wait = false ;
+
+#define FREE_ALL                        \
+{                                       \
+    GB_MATRIX_FREE (&C) ;               \
+    GB_mx_put_global (true, 0) ;        \
+}
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+
+    GrB_Matrix C = NULL ;
+    GrB_BinaryOp dup = NULL ;
+    GrB_Index *I = NULL, ni = 0, I_range [3] ;
+    GrB_Index *J = NULL, nj = 0, J_range [3] ;
+    bool is_list ;
+
+    // check inputs
+    GB_WHERE (USAGE) ;
+    if (nargout > 1 || nargin < 4 || nargin > 6)
+    {
+        mexErrMsgTxt ("Usage: " USAGE) ;
+    }
+
+    // get C (deep copy)
+    #define GET_DEEP_COPY \
+    C = GB_mx_mxArray_to_Matrix (pargin [0], "C input", true, true) ;
+    #define FREE_DEEP_COPY GB_MATRIX_FREE (&C) ;
+    GET_DEEP_COPY ;
+    if (C == NULL)
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("C failed") ;
+    }
+    if (C->type != GrB_FP64)
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("C must be double") ;
+    }
+    mxClassID cclass = GB_mx_Type_to_classID (C->type) ;
+
+    // get I and J
+    if (!GB_mx_mxArray_to_indices (&I, pargin [1], &ni, I_range, &is_list)
+        || !is_list)
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("I is invalid; must be a list") ;
+    }
+    if (!GB_mx_mxArray_to_indices (&J, pargin [2], &nj, J_range, &is_list)
+        || !is_list)
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("J is invalid; must be a list") ;
+    }
+    if (ni != nj)
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("I and J must be the same size") ;
+    }
+
+    // get X; it must be a dense double array
+    if (ni != mxGetNumberOfElements (pargin [3]) ||
+        !mxIsDouble (pargin [3]) || mxIsSparse (pargin [3]))
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("X must be a dense double array, same size as I") ;
+    }
+    double *X = mxGetPr (pargin [3]) ;
+
+    // get dup; default is PLUS_FP64
+    if (nargin > 4)
+    {
+        if (!GB_mx_mxArray_to_BinaryOp (&dup, pargin [4], "dup",
+            GB_PLUS_opcode, cclass, false, false))
+        {
+            FREE_ALL ;
+            mexErrMsgTxt ("dup failed") ;
+        }
+    }
+    else
+    {
+        dup = GrB_PLUS_FP64 ;
+    }
+
+    // get the debug_wait flag, to force assembly afterwards
+    if (nargin > 5)
+    {
+        debug_wait = (mxGetScalar (pargin [5]) != 0) ;
+    }
+
+    // C(I(k),J(k)) = X(k), in bulk
+    METHOD (GxB_Matrix_setElements (C, I, J, X, ni, dup)) ;
+
+    if (debug_wait)
+    {
+        GB_wait (C, Context) ;
+    }
+
+    // return C to MATLAB as a struct and free the GraphBLAS C
+    pargout [0] = GB_mx_Matrix_to_mxArray (&C, "C setElements result", true) ;
+
+    FREE_ALL ;
+}
@@ -0,0 +1,69 @@
+//------------------------------------------------------------------------------
+// GB_mex_validate: ok = validate (A), with optional injected corruption
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// This is for testing only.  See GxB_Matrix_validate instead.  With corrupt nonzero, the first
+// index of the (deep copy of) A is driven out of range before the
+// check runs, so the test can see the corruption detected.
+
+#include "GB_mex.h"
+
+#define USAGE "ok = GB_mex_validate (A, nsamples, corrupt)"
+
+#define FREE_ALL                        \
+{                                       \
+    GB_MATRIX_FREE (&A) ;               \
+    GB_mx_put_global (true, 0) ;        \
+}
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL ;
+
+    GB_WHERE (USAGE) ;
+
+    // check inputs
+    if (nargout > 1 || nargin < 1 || nargin > 3)
+    {
+        mexErrMsgTxt ("Usage: " USAGE) ;
+    }
+
+    // get A (deep copy, since it may be corrupted below)
+    #define GET_DEEP_COPY \
+    A = GB_mx_mxArray_to_Matrix (pargin [0], "A input", true, true) ;
+    #define FREE_DEEP_COPY GB_MATRIX_FREE (&A) ;
+    GET_DEEP_COPY ;
+    if (A == NULL)
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("A failed") ;
+    }
+
+    GrB_Index nsamples = (nargin > 1) ?
+        ((GrB_Index) mxGetScalar (pargin [1])) : A->nvec ;
+    bool corrupt = (nargin > 2) && (mxGetScalar (pargin [2]) != 0) ;
+
+    if (corrupt && GB_NNZ (A) > 0)
+    {
+        // drive the first index out of range
+        A->i [0] = A->vlen + 5 ;
+    }
+
+    GrB_Info info = GxB_Matrix_validate (A, nsamples) ;
+    pargout [0] = mxCreateDoubleScalar ((info == GrB_SUCCESS) ? 1 : 0) ;
+
+    FREE_ALL ;
+}
@@ -0,0 +1,66 @@
+function test151
+%TEST151 test GxB_Matrix_eWiseUnion
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+% http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+fprintf ('\ntest151: GxB_Matrix_eWiseUnion -------------------------------\n') ;
+
+rng ('default') ;
+
+for trial = 1:10
+
+    m = 10 ; n = 8 ;
+    A = sprand (m, n, 0.3) ;
+    B = sprand (m, n, 0.3) ;
+    alpha = pi ;
+    beta = 42 ;
+
+    % C = eWiseUnion (A, alpha, B, beta) with MINUS:
+    %   both present:  A(i,j) - B(i,j)
+    %   only A(i,j):   A(i,j) - beta
+    %   only B(i,j):   alpha - B(i,j)
+    C1 = GB_mex_eWiseUnion (A, alpha, B, beta, 'minus') ;
+
+    inA = logical (spones (A)) ;
+    inB = logical (spones (B)) ;
+    C2 = sparse (m, n) ;
+    both = inA & inB ;
+    onlyA = inA & ~inB ;
+    onlyB = ~inA & inB ;
+    C2 (both)  = A (both) - B (both) ;
+    C2 (onlyA) = A (onlyA) - beta ;
+    C2 (onlyB) = alpha - B (onlyB) ;
+
+    assert (isequal (C1, C2)) ;
+
+    % compare the matched entries against eWiseAdd: they must agree, and
+    % the unmatched entries must differ from copy-through when the fills
+    % are nonzero
+    C3 = GB_mex_AplusB (A, B, 'minus') ;
+    assert (isequal (C1 (both), C3 (both))) ;
+    assert (isequal (C3 (onlyA), A (onlyA))) ;      % eWiseAdd copies through
+    assert (isequal (C1 (onlyA), A (onlyA) - beta)) ;   % eWiseUnion fills
+
+    % with zero fills, eWiseUnion with MINUS is A-B exactly
+    C4 = GB_mex_eWiseUnion (A, 0, B, 0, 'minus') ;
+    assert (norm (C4 - (A-B), 1) == 0) ;
+
+    % masked variant: only entries where M is true are computed
+    M = logical (sprand (m, n, 0.5)) ;
+    C5 = GB_mex_eWiseUnion (A, alpha, B, beta, 'minus', sparse (M)) ;
+    C6 = C2 ;
+    C6 (~M) = 0 ;
+    assert (isequal (C5, sparse (C6))) ;
+
+    % PLUS is symmetric in the fills
+    C7 = GB_mex_eWiseUnion (A, 3, B, 3, 'plus') ;
+    C8 = sparse (m, n) ;
+    C8 (both)  = A (both) + B (both) ;
+    C8 (onlyA) = A (onlyA) + 3 ;
+    C8 (onlyB) = B (onlyB) + 3 ;
+    assert (isequal (C7, C8)) ;
+
+end
+
+fprintf ('\ntest151: all tests passed\n') ;
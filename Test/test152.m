@@ -0,0 +1,61 @@
+function test152
+%TEST152 test GxB_Matrix_setElements
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+% http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+fprintf ('\ntest152: GxB_Matrix_setElements ------------------------------\n') ;
+
+rng ('default') ;
+
+for trial = 1:10
+    for debug_wait = 0:1
+
+        m = 12 ; n = 9 ;
+        C = sprand (m, n, 0.4) ;
+
+        % a batch with intra-batch duplicates; (3,3) appears twice and
+        % must be combined with the dup operator, not last-one-wins
+        I = [1 3 3 5 12 1]' ;
+        J = [1 3 3 7  9 1]' ;
+        X = [10 20 30 40 50 60]' ;
+        I0 = uint64 (I-1) ;
+        J0 = uint64 (J-1) ;
+
+        C1 = GB_mex_setElements (C, I0, J0, X, 'plus', debug_wait) ;
+
+        % expected: combine duplicates within the batch with plus, then
+        % overwrite the addressed entries of C, leaving the rest unchanged
+        E = C ;
+        E (1,1)  = 10 + 60 ;
+        E (3,3)  = 20 + 30 ;
+        E (5,7)  = 40 ;
+        E (12,9) = 50 ;
+        assert (isequal (C1.matrix, E)) ;
+
+        % entries not referenced by the batch are preserved, both the
+        % existing ones and the empty positions
+        D = E - C ;
+        [iD, jD] = find (D) ;
+        assert (all (ismember ([iD jD], [I J], 'rows'))) ;
+
+        % a second batch on the same matrix exercises the interaction with
+        % pending tuples from the first call (when debug_wait is false the
+        % first update may still be pending inside C1)
+        I2 = uint64 ([2 5]-1) ;
+        J2 = uint64 ([2 7]-1) ;
+        X2 = [7 8]' ;
+        C2 = GB_mex_setElements (C1, I2, J2, X2, 'plus', debug_wait) ;
+        E (2,2) = 7 ;
+        E (5,7) = 8 ;
+        assert (isequal (C2.matrix, E)) ;
+
+        % an empty batch is a no-op
+        C3 = GB_mex_setElements (C, uint64([]), uint64([]), [ ], 'plus', ...
+            debug_wait) ;
+        assert (isequal (C3.matrix, C)) ;
+
+    end
+end
+
+fprintf ('\ntest152: all tests passed\n') ;
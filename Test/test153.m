@@ -0,0 +1,54 @@
+function test153
+%TEST153 test GrB_Matrix_removeElement
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+% http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+fprintf ('\ntest153: GrB_Matrix_removeElement ----------------------------\n') ;
+
+rng ('default') ;
+
+for trial = 1:10
+    for debug_wait = 0:1
+
+        m = 10 ; n = 10 ;
+        C = sprand (m, n, 0.5) ;
+        C (2,2) = 42 ;
+        C (3,7) = 99 ;
+
+        % remove two entries that exist, one that does not (a no-op), and
+        % one entry twice (the second removal is also a no-op)
+        I = [2 3 9 2]' ;
+        J = [2 7 9 2]' ;
+        I0 = uint64 (I-1) ;
+        J0 = uint64 (J-1) ;
+        if (C (9,9) ~= 0)
+            C (9,9) = 0 ;   % make sure (9,9) is not present
+        end
+
+        C1 = GB_mex_removeElement (C, I0, J0, debug_wait) ;
+
+        E = C ;
+        E (2,2) = 0 ;
+        E (3,7) = 0 ;
+        assert (isequal (C1.matrix, E)) ;
+        assert (nnz (C1.matrix) == nnz (E)) ;
+
+        % zombie then re-set: with debug_wait false the removals above
+        % leave zombies in C1; setting one of the removed entries again
+        % must bring it back (resurrecting the zombie in place)
+        C2 = GB_mex_setElements (C1, uint64 (2-1), uint64 (2-1), 77, ...
+            'plus', debug_wait) ;
+        E (2,2) = 77 ;
+        assert (isequal (C2.matrix, E)) ;
+
+        % and removing it again must delete it again
+        C3 = GB_mex_removeElement (C2, uint64 (2-1), uint64 (2-1), ...
+            debug_wait) ;
+        E (2,2) = 0 ;
+        assert (isequal (C3.matrix, E)) ;
+
+    end
+end
+
+fprintf ('\ntest153: all tests passed\n') ;
@@ -0,0 +1,57 @@
+function test154
+%TEST154 test dense-times-dense mxm (the CBLAS gemm bridge, when compiled)
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+% http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+% When the library is compiled with -DGB_WITH_CBLAS, completely dense
+% PLUS_TIMES_FP64 products dispatch to cblas_dgemm (GB_AxB_gemm);
+% otherwise they run through the sparse methods.  Either way the results
+% must match MATLAB in all four transpose combinations, so this test
+% validates the bridge when present and the selection fallback when not.
+
+fprintf ('\ntest154: dense-times-dense mxm (gemm bridge if compiled) -----\n') ;
+
+rng ('default') ;
+
+for trial = 1:5
+
+    m = 30 ; k = 20 ; n = 10 ;
+
+    % completely dense operands, stored as sparse matrices
+    A = sparse (rand (m, k)) ;
+    B = sparse (rand (k, n)) ;
+
+    % C = A*B
+    C1 = GB_mex_AxB (A, B, false, false) ;
+    assert (norm (C1 - A*B, 1) / norm (C1, 1) < 1e-12) ;
+
+    % C = A'*B
+    A2 = sparse (rand (k, m)) ;
+    C2 = GB_mex_AxB (A2, B, true, false) ;
+    assert (norm (C2 - A2'*B, 1) / norm (C2, 1) < 1e-12) ;
+
+    % C = A*B'
+    B2 = sparse (rand (n, k)) ;
+    C3 = GB_mex_AxB (A, B2, false, true) ;
+    assert (norm (C3 - A*B2', 1) / norm (C3, 1) < 1e-12) ;
+
+    % C = A'*B'
+    C4 = GB_mex_AxB (A2, B2, true, true) ;
+    assert (norm (C4 - A2'*B2', 1) / norm (C4, 1) < 1e-12) ;
+
+    % a sparse-dense pair must not take the bridge: results still match
+    S = sprand (m, k, 0.1) ;
+    C5 = GB_mex_AxB (S, B, false, false) ;
+    assert (norm (C5 - S*B, 1) / max (norm (C5, 1), 1) < 1e-12) ;
+
+    % degenerate inner dimension: the bridge must not produce explicit
+    % zeros where the sparse methods produce an empty pattern
+    E1 = sparse (m, 0) ;
+    E2 = sparse (0, n) ;
+    C6 = GB_mex_AxB (E1, E2, false, false) ;
+    assert (nnz (C6) == 0) ;
+
+end
+
+fprintf ('\ntest154: all tests passed\n') ;
@@ -0,0 +1,50 @@
+function test155
+%TEST155 test GxB_*_apply_BinaryOp1st and GxB_*_apply_BinaryOp2nd
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+% http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+fprintf ('\ntest155: GxB_*_apply_BinaryOp1st/2nd -------------------------\n') ;
+
+rng ('default') ;
+
+for trial = 1:10
+
+    m = 10 ; n = 6 ;
+    A = sprand (m, n, 0.4) ;
+    [i, j, x] = find (A) ;
+    s = pi ;
+
+    % C = minus (s, A), on the pattern of A only
+    C1 = GB_mex_apply_bind (A, s, 'minus', 1) ;
+    C2 = sparse (i, j, s - x, m, n) ;
+    assert (isequal (C1, C2)) ;
+
+    % C = minus (A, s)
+    C3 = GB_mex_apply_bind (A, s, 'minus', 0) ;
+    C4 = sparse (i, j, x - s, m, n) ;
+    assert (isequal (C3, C4)) ;
+
+    % the two bindings agree for a commutative op
+    C5 = GB_mex_apply_bind (A, s, 'plus', 1) ;
+    C6 = GB_mex_apply_bind (A, s, 'plus', 0) ;
+    assert (isequal (C5, C6)) ;
+
+    % vector variants
+    u = sprand (m, 1, 0.6) ;
+    [i, ~, x] = find (u) ;
+    w1 = GB_mex_apply_bind (u, s, 'minus', 1, 1) ;
+    w2 = sparse (i, 1, s - x, m, 1) ;
+    assert (isequal (w1, w2)) ;
+    w3 = GB_mex_apply_bind (u, s, 'minus', 0, 1) ;
+    w4 = sparse (i, 1, x - s, m, 1) ;
+    assert (isequal (w3, w4)) ;
+
+    % empty matrix
+    E = sparse (m, n) ;
+    C7 = GB_mex_apply_bind (E, s, 'plus', 1) ;
+    assert (nnz (C7) == 0) ;
+
+end
+
+fprintf ('\ntest155: all tests passed\n') ;
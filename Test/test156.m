@@ -0,0 +1,39 @@
+function test156
+%TEST156 test GxB_Matrix_diag and GxB_Vector_diag
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+% http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+fprintf ('\ntest156: GxB_Matrix_diag and GxB_Vector_diag -----------------\n') ;
+
+rng ('default') ;
+
+for trial = 1:10
+    for k = [-3 -1 0 1 4]
+
+        % extraction: v = diag (A,k) for a rectangular sparse A
+        m = 8 ; n = 10 ;
+        A = sprand (m, n, 0.4) ;
+        v1 = GB_mex_diag (A, k) ;
+        v2 = sparse (diag (A, k)) ;
+        assert (isequal (v1, v2)) ;
+
+        % construction: C = diag (u,k) from a sparse vector u
+        u = sprand (6, 1, 0.5) ;
+        C1 = GB_mex_diag (u, k) ;
+        C2 = sparse (diag (u, k)) ;
+        assert (isequal (C1, C2)) ;
+
+        % round trip: extracting the kth diagonal of diag (u,k) gives u
+        v3 = GB_mex_diag (C1, k) ;
+        assert (isequal (v3, u)) ;
+
+    end
+end
+
+% empty diagonal: k beyond the dimensions
+A = sprand (4, 4, 0.5) ;
+v = GB_mex_diag (A, 4) ;
+assert (isempty (v) || nnz (v) == 0) ;
+
+fprintf ('\ntest156: all tests passed\n') ;
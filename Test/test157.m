@@ -0,0 +1,44 @@
+function test157
+%TEST157 test GxB_Matrix_rowDegree and GxB_Matrix_colDegree
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+% http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+fprintf ('\ntest157: GxB_Matrix_rowDegree/colDegree ----------------------\n') ;
+
+rng ('default') ;
+
+for trial = 1:10
+
+    m = 20 ; n = 15 ;
+    A = sprand (m, n, 0.2) ;
+
+    % row degrees: one entry per non-empty row
+    d1 = GB_mex_degree (A, 1) ;
+    d2 = sparse (sum (spones (A), 2)) ;
+    assert (isequal (d1, d2)) ;
+
+    % column degrees
+    d3 = GB_mex_degree (A, 0) ;
+    d4 = sparse (sum (spones (A), 1)') ;
+    assert (isequal (d3, d4)) ;
+
+    % both orientations of the stored matrix give the same answer
+    % (the CSR/CSC-matching direction is the O(nvec) path)
+    S.matrix = A ;
+    for is_csc = 0:1
+        S.is_csc = is_csc ;
+        d5 = GB_mex_degree (S, 1) ;
+        assert (isequal (d5, d2)) ;
+        d6 = GB_mex_degree (S, 0) ;
+        assert (isequal (d6, d4)) ;
+    end
+
+end
+
+% empty matrix: no entries, empty degree vector
+E = sparse (5, 5) ;
+d = GB_mex_degree (E, 1) ;
+assert (nnz (d) == 0) ;
+
+fprintf ('\ntest157: all tests passed\n') ;
@@ -0,0 +1,55 @@
+function test158
+%TEST158 test GxB_Matrix_isequal
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+% http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+fprintf ('\ntest158: GxB_Matrix_isequal ----------------------------------\n') ;
+
+rng ('default') ;
+
+for trial = 1:10
+
+    m = 10 ; n = 8 ;
+    A = sprand (m, n, 0.3) ;
+
+    % identical matrices are equal
+    assert (GB_mex_isequal (A, A) == 1) ;
+
+    % a value difference is detected
+    B = A ;
+    [i, j] = find (A, 1) ;
+    if (~isempty (i))
+        B (i, j) = B (i, j) + 1 ;
+        assert (GB_mex_isequal (A, B) == 0) ;
+    end
+
+    % a pattern difference with the same nvals is detected
+    C = A ;
+    if (~isempty (i))
+        C (i, j) = 0 ;           % remove one entry
+        C (m, n) = 42 ;          % and add another
+        assert (GB_mex_isequal (A, C) == 0) ;
+    end
+
+    % a dimension difference is detected (O(1) short circuit)
+    D = sprand (m, n+1, 0.3) ;
+    assert (GB_mex_isequal (A, D) == 0) ;
+
+    % hypersparse versus standard storage of the same matrix is equal
+    S1.matrix = A ; S1.is_hyper = 0 ;
+    S2.matrix = A ; S2.is_hyper = 1 ;
+    assert (GB_mex_isequal (S1, S2) == 1) ;
+
+    % mixed CSR/CSC formats report GrB_NO_VALUE (-1 from the wrapper)
+    F1.matrix = A ; F1.is_csc = 1 ;
+    F2.matrix = A ; F2.is_csc = 0 ;
+    assert (GB_mex_isequal (F1, F2) == -1) ;
+
+end
+
+% empty matrices are equal
+E = sparse (4, 4) ;
+assert (GB_mex_isequal (E, sparse (4, 4)) == 1) ;
+
+fprintf ('\ntest158: all tests passed\n') ;
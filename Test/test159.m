@@ -0,0 +1,30 @@
+function test159
+%TEST159 test GxB_Matrix_fit
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+% http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+fprintf ('\ntest159: GxB_Matrix_fit --------------------------------------\n') ;
+
+rng ('default') ;
+
+for trial = 1:10
+
+    m = 30 ; n = 20 ;
+    C = sprand (m, n, 0.3) ;
+
+    % the harness inflates the capacity 4x before fitting, so the fit
+    % must trim it: the content is unchanged and the footprint shrinks
+    [C1, bytes] = GB_mex_fit (C) ;
+    assert (isequal (C1.matrix, C)) ;
+    assert (bytes (2) < bytes (1)) ;
+
+    % fitting an empty matrix is safe
+    E = sparse (m, n) ;
+    [E1, ebytes] = GB_mex_fit (E) ;
+    assert (isequal (E1.matrix, E)) ;
+    assert (ebytes (2) <= ebytes (1)) ;
+
+end
+
+fprintf ('\ntest159: all tests passed\n') ;
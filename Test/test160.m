@@ -0,0 +1,34 @@
+function test160
+%TEST160 test GxB_Matrix_memoryUsage and the memory telemetry options
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+% http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+fprintf ('\ntest160: GxB_Matrix_memoryUsage ------------------------------\n') ;
+
+rng ('default') ;
+
+for trial = 1:10
+
+    m = 50 ; n = 40 ;
+    A = sprand (m, n, 0.1) ;
+    B = sprand (m, n, 0.4) ;
+
+    % more entries cost more bytes; every matrix costs at least its header
+    [abytes, stats] = GB_mex_memoryUsage (A) ;
+    bbytes = GB_mex_memoryUsage (B) ;
+    assert (abytes > 0) ;
+    assert (bbytes > abytes) ;
+
+    % the byte count grows with the pattern and values: 16 bytes per
+    % entry (8-byte index plus 8-byte double) at exact capacity
+    assert (bbytes - abytes >= 16 * (nnz (B) - nnz (A))) ;
+
+    % the global counters are readable; tracking is off by default in
+    % production, in which case the counters may be zero
+    assert (numel (stats) == 3) ;
+    assert (stats (2) >= 0 && stats (3) >= stats (2) - eps) ;
+
+end
+
+fprintf ('\ntest160: all tests passed\n') ;
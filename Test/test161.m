@@ -0,0 +1,36 @@
+function test161
+%TEST161 test GxB_Matrix_validate
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+% http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+fprintf ('\ntest161: GxB_Matrix_validate ---------------------------------\n') ;
+
+rng ('default') ;
+
+for trial = 1:10
+
+    m = 20 ; n = 15 ;
+    A = sprand (m, n, 0.3) ;
+
+    % a healthy matrix passes, with sampled and full pattern checks
+    assert (GB_mex_validate (A, 0) == 1) ;
+    assert (GB_mex_validate (A, 4) == 1) ;
+    assert (GB_mex_validate (A, n) == 1) ;
+    assert (GB_mex_validate (A, 2*n) == 1) ;
+
+    % an out-of-range index is detected by the full pattern check
+    if (nnz (A) > 0)
+        assert (GB_mex_validate (A, n, 1) == 0) ;
+    end
+
+    % hypersparse storage is validated too
+    S.matrix = A ; S.is_hyper = 1 ;
+    assert (GB_mex_validate (S, n) == 1) ;
+
+end
+
+% empty matrices pass
+assert (GB_mex_validate (sparse (5, 5), 5) == 1) ;
+
+fprintf ('\ntest161: all tests passed\n') ;
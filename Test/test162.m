@@ -0,0 +1,49 @@
+function test162
+%TEST162 test GxB_Matrix_nvals_estimate
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+% http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+fprintf ('\ntest162: GxB_Matrix_nvals_estimate ---------------------------\n') ;
+
+rng ('default') ;
+
+for trial = 1:10
+
+    m = 15 ; n = 12 ;
+    C = sprand (m, n, 0.3) ;
+
+    % a batch that overwrites one existing entry (if any), adds two new
+    % ones, and duplicates one update
+    [i, j] = find (C, 1) ;
+    if (isempty (i))
+        i = 1 ; j = 1 ;
+    end
+    I = uint64 ([i 1 m 1]-1) ;
+    J = uint64 ([j n n n]-1) ;
+    X = [99 1 2 3]' ;
+
+    b = GB_mex_nvals_estimate (C, I, J, X) ;
+    lower = b (1) ; upper = b (2) ; exact = b (3) ;
+
+    % with the updates pending: lower is the stored live count, upper
+    % adds the pending updates, and the exact count (after assembly)
+    % must lie inside the bounds
+    assert (lower <= exact) ;
+    assert (exact <= upper) ;
+    assert (upper == lower + numel (X)) ;
+
+    % the exact count matches MATLAB
+    E = C ;
+    E (i, j) = 99 ;
+    E (1, n) = 3 ;          % setElement semantics: the last call wins
+    E (m, n) = 2 ;
+    assert (exact == nnz (E)) ;
+
+    % with no pending work, the bounds collapse to the exact count
+    b2 = GB_mex_nvals_estimate (C, uint64([]), uint64([]), [ ]) ;
+    assert (b2 (1) == nnz (C) && b2 (2) == nnz (C) && b2 (3) == nnz (C)) ;
+
+end
+
+fprintf ('\ntest162: all tests passed\n') ;
@@ -0,0 +1,39 @@
+function test163
+%TEST163 test GxB_mxm_estimate
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+% http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+fprintf ('\ntest163: GxB_mxm_estimate ------------------------------------\n') ;
+
+rng ('default') ;
+
+for trial = 1:10
+
+    m = 20 ; k = 15 ; n = 10 ;
+    A = sprand (m, k, 0.2) ;
+    B = sprand (k, n, 0.3) ;
+
+    e = GB_mex_mxm_estimate (A, B) ;
+    flops = e (1) ; bound = e (2) ;
+
+    % the flop count for C=A*B is sum over entries B(t,j) of nnz(A(:,t))
+    cdA = full (sum (spones (A), 1)) ;
+    [ti, ~] = find (B) ;
+    flops_matlab = sum (cdA (ti)) ;
+    assert (flops == flops_matlab) ;
+
+    % the bound dominates the true nnz of the product and never exceeds
+    % the flop count or the dimensions
+    C = A * B ;
+    assert (bound >= nnz (C)) ;
+    assert (bound <= flops + eps) ;
+    assert (bound <= m * n) ;
+
+    % empty operands: zero flops, zero bound
+    e0 = GB_mex_mxm_estimate (sparse (m, k), sparse (k, n)) ;
+    assert (e0 (1) == 0 && e0 (2) == 0) ;
+
+end
+
+fprintf ('\ntest163: all tests passed\n') ;
@@ -0,0 +1,26 @@
+function test164
+%TEST164 test GxB_AXB_METHOD_COUNTS
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+% http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+fprintf ('\ntest164: GxB_AXB_METHOD_COUNTS -------------------------------\n') ;
+
+rng ('default') ;
+
+% the counters are cumulative since GrB_init: reading them twice with a
+% multiply in between must show growth, and they never decrease
+c1 = GB_mex_method_counts ;
+assert (numel (c1) == 6) ;
+assert (all (c1 >= 0)) ;
+
+A = sprand (50, 40, 0.2) ;
+B = sprand (40, 30, 0.2) ;
+C = GB_mex_AxB (A, B) ;
+assert (norm (C - A*B, 1) / max (norm (C, 1), 1) < 1e-12) ;
+
+c2 = GB_mex_method_counts ;
+assert (all (c2 >= c1)) ;
+assert (sum (c2) > sum (c1)) ;
+
+fprintf ('\ntest164: all tests passed\n') ;
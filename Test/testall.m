@@ -66,6 +66,20 @@ logstat ;             % start the log.txt
 %----------------------------------------
 
 logstat ('test07b',t) ; % quick test GB_mex_assign
+logstat ('test151',t) ; % GxB_Matrix_eWiseUnion
+logstat ('test152',t) ; % GxB_Matrix_setElements
+logstat ('test153',t) ; % GrB_Matrix_removeElement
+logstat ('test154',t) ; % dense-times-dense mxm (gemm bridge if compiled)
+logstat ('test155',t) ; % GxB_*_apply_BinaryOp1st/2nd
+logstat ('test156',t) ; % GxB_Matrix_diag and GxB_Vector_diag
+logstat ('test157',t) ; % GxB_Matrix_rowDegree/colDegree
+logstat ('test158',t) ; % GxB_Matrix_isequal
+logstat ('test159',t) ; % GxB_Matrix_fit
+logstat ('test160',t) ; % GxB_Matrix_memoryUsage
+logstat ('test161',t) ; % GxB_Matrix_validate
+logstat ('test162',t) ; % GxB_Matrix_nvals_estimate
+logstat ('test163',t) ; % GxB_mxm_estimate
+logstat ('test164',t) ; % GxB_AXB_METHOD_COUNTS
 logstat ('test01',t) ;  % error handling
 logstat ('test01',s) ;  % error handling
 logstat ('test83',t) ;  % GrB_assign with C_replace and empty J